@@ -7,8 +7,8 @@
 *@brief     Thermistor measurement and processing
 *@author    Ziga Miklosic
 *@email     ziga.miklosic@gmail.com
-*@date      01.02.2025
-*@version   V1.2.0
+*@date      16.10.2026
+*@version   V1.3.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /*!
@@ -23,21 +23,13 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "thermistor.h"
 
-// Filer module
-#if ( 1 == TH_FILTER_EN )
-    #include "middleware/filter/src/filter.h"
-
-    /**
-     *  Compatibility check with Filter module
-     *
-     *  Support version V2.x.x
-     */
-    _Static_assert( 2 == FILTER_VER_MAJOR );
-
+#if ( 1 == TH_SNAPSHOT_EN ) || ( 1 == TH_EVENT_EN )
+    #include <stdatomic.h>
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,13 +54,28 @@
  */
 #define TH_PT_DIN_EN60751_A     ( 3.9083e-3 )    // degC^-1
 #define TH_PT_DIN_EN60751_B     ( -5.775e-7 )    // degC^-2
+#define TH_PT_DIN_EN60751_C     ( -4.183e-12 )   // degC^-4, only bellow 0 degC
 
 /**
  *        Precalculated factors for PT100/500/1000 calculations
  */
-#define TH_PT_DIN_EN60751_AA    (( float32_t )( TH_PT_DIN_EN60751_A * TH_PT_DIN_EN60751_A ))
-#define TH_PT_DIN_EN60751_2B    (( float32_t )( 2.0 * TH_PT_DIN_EN60751_B ))
-#define TH_PT_DIN_EN60751_4B    (( float32_t )( 4.0 * TH_PT_DIN_EN60751_B ))
+#define TH_PT_DIN_EN60751_AA        (( float32_t )( TH_PT_DIN_EN60751_A * TH_PT_DIN_EN60751_A ))
+#define TH_PT_DIN_EN60751_4B        (( float32_t )( 4.0 * TH_PT_DIN_EN60751_B ))
+#define TH_PT_DIN_EN60751_INV_2B    (( float32_t )( 1.0 / ( 2.0 * TH_PT_DIN_EN60751_B )))
+
+/**
+ *        PT100/500/1000 inverse of full Callendar-Van Dusen equation 
+ *        bellow 0 degC
+ *
+ * @note  T = C1*u + C2*u^2 + C3*u^3 + C4*u^4, where u = R/R0 - 1. 
+ *
+ *        Least squares fit of full equation (including C coefficient)
+ *        in range from -200 to 0 degC. Maximum error is 0.002 degC.
+ */
+#define TH_PT_CVD_NEG_C1        ( 2.558196516e+02f )
+#define TH_PT_CVD_NEG_C2        ( 9.141516773e+00f )
+#define TH_PT_CVD_NEG_C3        ( -2.952616961e+00f )
+#define TH_PT_CVD_NEG_C4        ( 1.761996960e+00f )
 
 /**
  *        PT100/500/1000 Resistance Limits
@@ -84,401 +91,3687 @@
 #define TH_PT500_MAX_OHM        ( 1937.74f )
 #define TH_PT500_MIN_OHM        ( 114.13f )
 
+/**
+ *  Compatibility check of look-up table configuration
+ */
+#if ( 1 == TH_LUT_IN_FLASH ) && ( 1 != TH_LUT_EN )
+    #error "Thermistor: TH_LUT_IN_FLASH requires TH_LUT_EN!"
+#endif
+
+/**
+ *  Compatibility check of time base configuration
+ */
+#if (( 1 == TH_HNDL_BUDGET_EN ) || ( 1 == TH_PERF_EN )) && !defined( TH_GET_TIMESTAMP )
+    #error "Thermistor: TH_HNDL_BUDGET_EN and TH_PERF_EN require TH_GET_TIMESTAMP() in thermistor_cfg.h!"
+#endif
+
+/**
+ *  Allowed deviation of constant look-up table from calculation
+ *
+ *  Unit: degC
+ */
+#define TH_LUT_CHECK_TOL        ( 0.1f )
+
+/**
+ *  Maximum oversampling ratio
+ */
+#define TH_OVERSAMPLE_MAX       ( 256UL )
+
+/**
+ *  Maximum median pre-filter window
+ *
+ *  @note   History of each thermistor is padded to 8 samples.
+ */
+#define TH_MEDIAN_WIN_MAX       ( 7UL )
+#define TH_MEDIAN_HIST_SIZE     ( 8UL )
+
+/**
+ *  Compare and swap of sorting network
+ *
+ *  @note   Branchless, compiles to min/max or conditional moves.
+ */
+#define TH_SORT2(a,b)           do { const uint16_t lo_ = (( a ) < ( b )) ? ( a ) : ( b ); ( b ) = (( a ) < ( b )) ? ( b ) : ( a ); ( a ) = lo_; } while(0)
+
+/**
+ *  Compatibility check of fixed point configuration
+ */
+#if ( 1 == TH_FIXED_POINT_EN ) && ( 1 != TH_LUT_EN )
+    #error "Thermistor: TH_FIXED_POINT_EN requires TH_LUT_EN!"
+#endif
+
+/**
+ *  Internal temperature representation
+ *
+ *  @note   With fixed point pipeline temperature is kept in milli 
+ *          degC, otherwise in degC.
+ */
+#if ( 1 == TH_FIXED_POINT_EN )
+    typedef int32_t th_temp_t;
+
+    #define TH_TEMP_TO_DEGC(t)      ((float32_t) (t) * 1e-3f )
+    #define TH_TEMP_TO_MDEGC(t)     ( t )
+    #define TH_DEGC_TO_TEMP(t)      ((int32_t) lroundf(( t ) * 1e3f ))
+    #define TH_TEMP_MAX             ( INT32_MAX )
+    #define TH_TEMP_MIN             ( -INT32_MAX )
+#else
+    typedef float32_t th_temp_t;
+
+    #define TH_TEMP_TO_DEGC(t)      ( t )
+    #define TH_TEMP_TO_MDEGC(t)     ((int32_t) lroundf(( t ) * 1e3f ))
+    #define TH_DEGC_TO_TEMP(t)      ( t )
+    #define TH_TEMP_MAX             ( INFINITY )
+    #define TH_TEMP_MIN             ( -INFINITY )
+#endif
+
+#if ( 1 == TH_ALARM_EN )
+
+    /**
+     *  Number of alarm levels
+     *
+     *  @note   Level "i" is alarm bit "1 << i" of th_alarm_t, odd levels
+     *          are high alarms.
+     */
+    #define TH_ALARM_NUM_OF         ( 4U )
+
+    /**
+     *  Mask of all alarm bits of single thermistor
+     */
+    #define TH_ALARM_BITS_MASK      (( 1UL << TH_ALARM_NUM_OF ) - 1UL )
+
+#endif
+
+/**
+ *  Compatibility check of event queue size
+ */
+#if ( 1 == TH_EVENT_EN ) && (( TH_EVENT_QUEUE_SIZE < 2 ) || ( 0 != ( TH_EVENT_QUEUE_SIZE & ( TH_EVENT_QUEUE_SIZE - 1 ))))
+    #error "Thermistor: TH_EVENT_QUEUE_SIZE shall be power of 2!"
+#endif
+
+#if ( 1 == TH_FILTER_EN )
+
+    /**
+     *  Low pass filter coefficient fraction bits of fixed point 
+     *  pipeline
+     */
+    #define TH_LPF_K_FRAC_BITS      ( 16 )
+
+    /**
+     *  Low pass filter state fraction bits of fixed point pipeline
+     *
+     *  @note   Keeps sub milli degC residue so that filter with small
+     *          coefficient does not stall before reaching input.
+     */
+    #define TH_LPF_Y_FRAC_BITS      ( 8 )
+
+#endif
+
 /**
  *  Thermistor data
+ *
+ *  @note   Structure of arrays, each holding one value of all 
+ *          thermistors, so that handler touches only values it needs
+ *          and loops over thermistors can be vectorized.
+ */
+typedef struct
+{
+    uint16_t *      p_raw;          /**<Last RAW ADC code, decimated with oversampling */
+    float32_t *     p_res;          /**<Thermistor resistance */
+    th_temp_t *     p_temp;         /**<Temperature values */
+    th_temp_t *     p_temp_filt;    /**<Filtered temperature values */
+    th_status_t *   p_status;       /**<Thermistor status */
+
+    #if ( 1 == TH_ALARM_EN )
+        uint32_t *  p_alarm;        /**<Active alarms, th_alarm_t bitmask */
+    #endif
+} th_data_t;
+
+/**
+ *  Published thermistor data
+ *
+ *  @note   Values of single thermistor visible to getters.
+ */
+typedef struct
+{
+    uint16_t    raw;        /**<Last RAW ADC code, decimated with oversampling */
+    float32_t   res;        /**<Thermistor resistance */
+    th_temp_t   temp;       /**<Temperature values */
+    th_temp_t   temp_filt;  /**<Filtered temperature values */
+    th_status_t status;     /**<Thermistor status */
+
+    #if ( 1 == TH_ALARM_EN )
+        uint32_t    alarm;  /**<Active alarms, th_alarm_t bitmask */
+    #endif
+} th_pub_t;
+
+/**
+ *  Copy function of published thermistor data
+ *
+ *  @note   Called by th_pub_read_with() with published data, again
+ *          when handler published in the meantime. Shall only copy
+ *          data into "p_arg", as result of repeated call is discarded.
+ */
+typedef void (*pf_th_pub_copy_t)(const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg);
+
+/**
+ *  Copy of published data of single thermistor
+ */
+typedef struct
+{
+    uint32_t    th;     /**<Thermistor index */
+    th_pub_t    pub;    /**<Published thermistor data */
+} th_pub_one_t;
+
+/**
+ *  Copy of published data of all thermistors
+ */
+typedef struct
+{
+    th_sample_t *   p_samples;  /**<Buffer of samples, one per thermistor */
+    uint32_t *      p_fault;    /**<Fault mask, can be NULL */
+} th_pub_all_t;
+
+/**
+ *  Thermistor status limits
+ *
+ *  @note   Structure of arrays, same as thermistor data. Holds also
+ *          debounce state of status change.
  */
 typedef struct
 {
-    float32_t res;        /**<Thermistor resistance */
-    float32_t temp;       /**<Temperature values in degC */
-    float32_t temp_filt;  /**<Filtered temperature values in degC */
+    th_temp_t *     p_range_min;    /**<Minimum allowed limit in internal units */
+    th_temp_t *     p_range_max;    /**<Maximum allowed limit in internal units */
+    th_temp_t *     p_clear_min;    /**<Limit to clear bellow minimum status, minimum plus hysteresis */
+    th_temp_t *     p_clear_max;    /**<Limit to clear above maximum status, maximum minus hysteresis */
+    th_status_t *   p_status_min;   /**<Status when bellow minimum limit */
+    th_status_t *   p_status_max;   /**<Status when above maximum limit */
+    th_status_t *   p_status_cand;  /**<Status of range check, waiting for debounce */
+    th_err_type_t * p_err_type;     /**<Error type */
+    uint32_t *      p_debounce;     /**<Consecutive samples to confirm status change */
+    th_status_t *   p_deb_cand;     /**<Status candidate being debounced */
+    uint32_t *      p_deb_cnt;      /**<Consecutive samples with the same changed status */
+    uint32_t *      p_is_new;       /**<New sample processed since last status check, 0 or 1 */
+
+    #if ( 1 == TH_ALARM_EN )
+        th_temp_t * p_alarm_set;    /**<Alarm set limits, TH_ALARM_NUM_OF arrays of all thermistors */
+        th_temp_t * p_alarm_clr;    /**<Alarm clear limits, set limits moved inwards by hysteresis */
+    #endif
+
+    #if ( 1 == TH_DIAG_EN )
+        th_temp_t *     p_rate_max;     /**<Maximum temperature change between samples, TH_TEMP_MAX when disabled */
+        uint32_t *      p_stuck_max;    /**<Samples with unchanged RAW ADC code to detect stuck sensor, 0 when disabled */
+        uint32_t *      p_stuck_cnt;    /**<Consecutive samples with unchanged RAW ADC code */
+        th_status_t *   p_status_diag;  /**<Status of last detected sensor diagnostics fault */
+        uint32_t *      p_diag_hold;    /**<New samples diagnostics fault is still held as status candidate */
+    #endif
+} th_limit_t;
+
+#if ( 1 == TH_FILTER_EN )
+
+    /**
+     *  Low pass filter
+     *
+     *  @note   First order IIR: y += k * ( x - y ). Structure of arrays, 
+     *          same as thermistor data. Floating point filter state is 
+     *          filtered temperature itself.
+     */
+    typedef struct
+    {
+        float32_t *     p_fc;       /**<Cutoff frequency in Hz */
+
+        #if ( 1 == TH_FIXED_POINT_EN )
+            int32_t *   p_k;        /**<Coefficient, TH_LPF_K_FRAC_BITS fraction bits */
+            int32_t *   p_y;        /**<State in milli degC, TH_LPF_Y_FRAC_BITS fraction bits */
+        #else
+            float32_t * p_k;        /**<Coefficient */
+        #endif
+    } th_lpf_t;
+
+#endif
+
+#if ( 1 == TH_OVERSAMPLE_EN )
+
+    /**
+     *  Oversampling
+     *
+     *  @note   Structure of arrays, same as thermistor data.
+     */
+    typedef struct
+    {
+        uint32_t *  p_acc;      /**<Accumulator of RAW ADC codes */
+        uint32_t *  p_cnt;      /**<Samples until decimation */
+        uint32_t *  p_ratio;    /**<Oversampling ratio */
+        uint32_t *  p_shift;    /**<Decimation shift of accumulator */
+    } th_os_t;
+
+#endif
+
+#if ( 1 == TH_MEDIAN_EN )
+
+    /**
+     *  Median pre-filter
+     *
+     *  @note   History of RAW ADC codes is kept per thermistor, 
+     *          TH_MEDIAN_HIST_SIZE samples each, so that window of 
+     *          single thermistor is contiguous.
+     */
+    typedef struct
+    {
+        uint16_t *  p_hist;     /**<History of RAW ADC codes */
+        uint32_t *  p_idx;      /**<Index of oldest sample in history */
+        uint32_t *  p_win;      /**<Window size */
+    } th_med_t;
+
+#endif
+
+#if ( 1 == TH_PERF_EN )
+
+    /**
+     *  Execution time accumulator
+     *
+     *  Unit: TH_GET_TIMESTAMP() ticks
+     */
+    typedef struct
+    {
+        uint64_t    sum;                        /**<Sum of execution times */
+        uint32_t    cnt;                        /**<Number of measurements */
+        uint32_t    min;                        /**<Minimum execution time */
+        uint32_t    max;                        /**<Maximum execution time */
+        uint32_t    hist[TH_PERF_HIST_SIZE];    /**<Log2 histogram of execution time */
+    } th_perf_t;
+
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+
+    /**
+     *  Thermistor events
+     *
+     *  @note   Per thermistor values are structure of arrays, same as 
+     *          thermistor data. Queue is single producer (handler), 
+     *          single consumer ring buffer with free running indexes.
+     *          Indexes are at least 32-bit and wrap together with 
+     *          uint32_t arithmetic, also where unsigned int is 16-bit.
+     */
+    typedef struct
+    {
+        th_status_t *       p_status;   /**<Last reported status */
+
+        #if ( 1 == TH_ALARM_EN )
+            uint32_t *      p_alarm;    /**<Last reported alarms */
+        #endif
+
+        th_temp_t *         p_thr;      /**<Threshold in internal units, TH_TEMP_MAX when disabled */
+        th_temp_t *         p_thr_clr;  /**<Threshold minus hysteresis in internal units */
+        uint32_t *          p_above;    /**<Filtered temperature is above threshold, 0 or 1 */
+
+        pf_th_event_cb_t        pf_cb;                          /**<Event callback, NULL when not registered */
+        th_event_t              queue[TH_EVENT_QUEUE_SIZE];     /**<Event queue */
+        atomic_uint_least32_t   wr;                             /**<Queue write index, owned by handler, free running 32-bit */
+        atomic_uint_least32_t   rd;                             /**<Queue read index, owned by consumer, free running 32-bit */
+        uint32_t                lost;                           /**<Events dropped since last queued one */
+    } th_evt_t;
+
+#endif
+
+#if ( 1 == TH_NTC_TAB_EN )
+
+    /**
+     *  NTC R-T table pre-calculated point
+     *
+     *  @note   Between two table points 1/T is linear function of ln(R):
+     *          1/T = inv_temp + k * ( ln(R) - ln_res )
+     */
+    typedef struct
+    {
+        float32_t ln_res;       /**<Natural logarithm of point resistance */
+        float32_t inv_temp;     /**<Inverse of point temperature in 1/K */
+        float32_t k;            /**<Slope towards next point */
+    } th_ntc_seg_t;
+
+#endif
+
+/**
+ *  Thermistor pre-calculated coefficients
+ */
+typedef struct th_coef_s th_coef_t;
+
+/**
+ *  Thermistor resistance calculation function
+ */
+typedef float32_t (*pf_th_calc_res_t)(const th_coef_t * const p_coef, const uint16_t raw);
+
+/**
+ *  Thermistor temperature calculation function
+ */
+typedef float32_t (*pf_th_calc_temp_t)(const th_coef_t * const p_coef, const float32_t rth);
+
+/**
+ *  Thermistor pre-calculated coefficients
+ *
+ *  @note   Derived from configuration table at init, so that
+ *          handler does not repeat any calculation or decision 
+ *          on static configuration.
+ */
+struct th_coef_s
+{
+    pf_th_calc_res_t    pf_calc_res;    /**<Resistance calculation function */
+    pf_th_calc_temp_t   pf_calc_temp;   /**<Temperature calculation function */
+
+    float32_t   raw_max;        /**<Maximum ADC code */
+    float32_t   raw_lsb;        /**<ADC code of single ADC LSB */
+    float32_t   pull;           /**<Resistance of pull resistor */
+    float32_t   both_n0;        /**<Both pull: numerator constant */
+    float32_t   both_n1;        /**<Both pull: numerator factor of ADC code */
+    float32_t   both_d0;        /**<Both pull: denominator constant */
+    float32_t   both_d1;        /**<Both pull: denominator factor of ADC code */
+    float32_t   res_min;        /**<Minimum thermistor resistance */
+    float32_t   res_max;        /**<Maximum thermistor resistance */
+    float32_t   ntc_inv_beta;   /**<NTC: 1 / beta, Steinhart-Hart: B */
+    float32_t   ntc_k;          /**<NTC: 1/T25 - ln(R25)/beta, Steinhart-Hart: A */
+    float32_t   ntc_c;          /**<Steinhart-Hart: C */
+    float32_t   pt_inv_r0;      /**<PT: 1 / R0 */
+
+    #if ( 1 == TH_PERF_EN )
+        th_perf_id_t    perf_id;    /**<Conversion kernel execution time statistics */
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        uint32_t    os_bits;    /**<Additional bits of decimated ADC code */
+
+        #if ( 1 == TH_LUT_EN )
+            float32_t   lut_k;  /**<Linear interpolation factor between look-up table points */
+        #endif
+    #endif
+
+    #if ( 1 == TH_NTC_TAB_EN )
+        const th_ntc_seg_t *    p_ntc_seg;      /**<NTC R-T table: pre-calculated points */
+        uint32_t                ntc_seg_num;    /**<NTC R-T table: number of points */
+    #endif
+};
+
+/**
+ *  Thermistor context
+ *
+ *  @note   Holds complete state of set of thermistors, so that 
+ *          independent contexts can run side by side.
+ */
+struct th_ctx_s
+{
+    const th_cfg_t *    p_cfg;          /**<Configuration table, used at init only */
+    th_data_t           data;           /**<Thermistor data */
+    th_limit_t          limit;          /**<Thermistor status limits */
+    th_coef_t *         p_coef;         /**<Thermistor pre-calculated coefficients */
+    adc_ch_t *          p_adc_ch;       /**<ADC channel of each thermistor */
+    uint32_t *          p_div;          /**<Handler calls per update of each thermistor */
+    uint32_t *          p_cnt;          /**<Handler calls until next update of each thermistor */
+    uint32_t            num_of;         /**<Number of thermistors */
+    bool                is_init;        /**<Initialization guard */
+
+    #if ( 1 == TH_FILTER_EN )
+        th_lpf_t            lpf;        /**<Low pass filter of each thermistor */
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        th_os_t             os;         /**<Oversampling of each thermistor */
+    #endif
+
+    #if ( 1 == TH_MEDIAN_EN )
+        th_med_t            med;        /**<Median pre-filter of each thermistor */
+    #endif
+
+    #if ( 1 == TH_LUT_EN )
+        const th_lut_t **   pp_lut;     /**<Pointers to look-up table of each thermistor */
+        th_lut_t *          p_lut_mem;  /**<Look-up tables storage, NULL for constant tables */
+        uint32_t            lut_shift;  /**<ADC code to look-up table index shift */
+        float32_t           lut_k;      /**<Linear interpolation factor between look-up table points */
+    #endif
+
+    #if ( 1 == TH_NTC_TAB_EN )
+        th_ntc_seg_t *      p_ntc_seg;      /**<Pool of NTC R-T table pre-calculated points */
+        uint32_t            ntc_seg_size;   /**<Size of NTC R-T table pool */
+    #endif
+
+    #if ( 1 == TH_SNAPSHOT_EN )
+        th_data_t           pub[2];     /**<Published thermistor data double buffer, "pub_seq & 1" is front */
+        atomic_uint         pub_seq;    /**<Publish sequence counter */
+    #endif
+
+    #if ( 1 == TH_HNDL_BUDGET_EN )
+        uint32_t            hndl_next;  /**<Next thermistor to process by time-sliced handler */
+        uint32_t            hndl_lag;   /**<Number of handler periods not yet fully processed */
+    #endif
+
+    #if ( 1 == TH_PERF_EN )
+        th_perf_t           perf[eTH_PERF_NUM_OF];  /**<Execution time statistics */
+    #endif
+
+    #if ( 1 == TH_EVENT_EN )
+        th_evt_t            evt;        /**<Thermistor events */
+    #endif
+};
+
+/**
+ *  Alignment of context storage sections
+ *
+ *  Unit: byte
+ */
+#define TH_CTX_ALIGN            ( 8UL )
+
+/**
+ *  Round size up to context storage section alignment
+ */
+#define TH_CTX_ALIGN_UP(size)   ((( size ) + ( TH_CTX_ALIGN - 1UL )) & ~( TH_CTX_ALIGN - 1UL ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Thermistor data storage of default context
+ */
+static struct
+{
+    uint16_t        raw         [eTH_NUM_OF];
+    float32_t       res         [eTH_NUM_OF];
+    th_temp_t       temp        [eTH_NUM_OF];
+    th_temp_t       temp_filt   [eTH_NUM_OF];
+    th_status_t     status      [eTH_NUM_OF];
+
+    th_temp_t       range_min   [eTH_NUM_OF];
+    th_temp_t       range_max   [eTH_NUM_OF];
+    th_temp_t       clear_min   [eTH_NUM_OF];
+    th_temp_t       clear_max   [eTH_NUM_OF];
+    th_status_t     status_min  [eTH_NUM_OF];
+    th_status_t     status_max  [eTH_NUM_OF];
+    th_status_t     status_cand [eTH_NUM_OF];
+    th_err_type_t   err_type    [eTH_NUM_OF];
+    uint32_t        debounce    [eTH_NUM_OF];
+    th_status_t     deb_cand    [eTH_NUM_OF];
+    uint32_t        deb_cnt     [eTH_NUM_OF];
+    uint32_t        is_new      [eTH_NUM_OF];
+
+    #if ( 1 == TH_ALARM_EN )
+        uint32_t        alarm       [eTH_NUM_OF];
+        th_temp_t       alarm_set   [TH_ALARM_NUM_OF][eTH_NUM_OF];
+        th_temp_t       alarm_clr   [TH_ALARM_NUM_OF][eTH_NUM_OF];
+    #endif
+
+    #if ( 1 == TH_DIAG_EN )
+        th_temp_t       rate_max    [eTH_NUM_OF];
+        uint32_t        stuck_max   [eTH_NUM_OF];
+        uint32_t        stuck_cnt   [eTH_NUM_OF];
+        th_status_t     status_diag [eTH_NUM_OF];
+        uint32_t        diag_hold   [eTH_NUM_OF];
+    #endif
+
+    adc_ch_t        adc_ch      [eTH_NUM_OF];
+    uint32_t        div         [eTH_NUM_OF];
+    uint32_t        cnt         [eTH_NUM_OF];
+
+    #if ( 1 == TH_FILTER_EN )
+        float32_t       lpf_fc  [eTH_NUM_OF];
+
+        #if ( 1 == TH_FIXED_POINT_EN )
+            int32_t     lpf_k   [eTH_NUM_OF];
+            int32_t     lpf_y   [eTH_NUM_OF];
+        #else
+            float32_t   lpf_k   [eTH_NUM_OF];
+        #endif
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        uint32_t        os_acc      [eTH_NUM_OF];
+        uint32_t        os_cnt      [eTH_NUM_OF];
+        uint32_t        os_ratio    [eTH_NUM_OF];
+        uint32_t        os_shift    [eTH_NUM_OF];
+    #endif
+
+    #if ( 1 == TH_MEDIAN_EN )
+        uint16_t        med_hist    [eTH_NUM_OF][TH_MEDIAN_HIST_SIZE];
+        uint32_t        med_idx     [eTH_NUM_OF];
+        uint32_t        med_win     [eTH_NUM_OF];
+    #endif
+
+    #if ( 1 == TH_EVENT_EN )
+        th_status_t     evt_status      [eTH_NUM_OF];
+
+        #if ( 1 == TH_ALARM_EN )
+            uint32_t    evt_alarm       [eTH_NUM_OF];
+        #endif
+
+        th_temp_t       evt_thr         [eTH_NUM_OF];
+        th_temp_t       evt_thr_clr     [eTH_NUM_OF];
+        uint32_t        evt_above       [eTH_NUM_OF];
+    #endif
+
+    #if ( 1 == TH_SNAPSHOT_EN )
+        uint16_t        pub_raw         [2][eTH_NUM_OF];
+        float32_t       pub_res         [2][eTH_NUM_OF];
+        th_temp_t       pub_temp        [2][eTH_NUM_OF];
+        th_temp_t       pub_temp_filt   [2][eTH_NUM_OF];
+        th_status_t     pub_status      [2][eTH_NUM_OF];
+
+        #if ( 1 == TH_ALARM_EN )
+            uint32_t    pub_alarm       [2][eTH_NUM_OF];
+        #endif
+    #endif
+} g_th_mem = {0};
+
+/**
+ *  Thermistor pre-calculated coefficients of default context
+ */
+static th_coef_t g_th_coef[eTH_NUM_OF] = {0};
+
+#if ( 1 == TH_LUT_EN )
+
+    #if ( 0 == TH_LUT_IN_FLASH )
+
+        /**
+         *  Look-up tables of ADC code to temperature conversion of
+         *  default context
+         *
+         *  Unit: degC
+         */
+        static th_lut_t g_th_lut[eTH_NUM_OF][TH_LUT_SIZE] = {0};
+
+    #endif
+
+    /**
+     *  Pointers to look-up table of each thermistor of default context
+     */
+    static const th_lut_t * gp_lut[eTH_NUM_OF] = {0};
+
+#endif
+
+#if ( 1 == TH_NTC_TAB_EN )
+
+    /**
+     *  Pool of NTC R-T table pre-calculated points of default context
+     */
+    static th_ntc_seg_t g_th_ntc_seg[TH_NTC_TAB_POOL_SIZE] = {0};
+
+#endif
+
+/**
+ *  Default context, used by API without context argument
+ */
+static th_ctx_t g_th_ctx =
+{
+    .p_cfg          = NULL,
+    .data           =
+    {
+        .p_raw          = g_th_mem.raw,
+        .p_res          = g_th_mem.res,
+        .p_temp         = g_th_mem.temp,
+        .p_temp_filt    = g_th_mem.temp_filt,
+        .p_status       = g_th_mem.status,
+
+        #if ( 1 == TH_ALARM_EN )
+            .p_alarm    = g_th_mem.alarm,
+        #endif
+    },
+    .limit          =
+    {
+        .p_range_min    = g_th_mem.range_min,
+        .p_range_max    = g_th_mem.range_max,
+        .p_clear_min    = g_th_mem.clear_min,
+        .p_clear_max    = g_th_mem.clear_max,
+        .p_status_min   = g_th_mem.status_min,
+        .p_status_max   = g_th_mem.status_max,
+        .p_status_cand  = g_th_mem.status_cand,
+        .p_err_type     = g_th_mem.err_type,
+        .p_debounce     = g_th_mem.debounce,
+        .p_deb_cand     = g_th_mem.deb_cand,
+        .p_deb_cnt      = g_th_mem.deb_cnt,
+        .p_is_new       = g_th_mem.is_new,
+
+        #if ( 1 == TH_ALARM_EN )
+            .p_alarm_set    = &g_th_mem.alarm_set[0][0],
+            .p_alarm_clr    = &g_th_mem.alarm_clr[0][0],
+        #endif
+
+        #if ( 1 == TH_DIAG_EN )
+            .p_rate_max     = g_th_mem.rate_max,
+            .p_stuck_max    = g_th_mem.stuck_max,
+            .p_stuck_cnt    = g_th_mem.stuck_cnt,
+            .p_status_diag  = g_th_mem.status_diag,
+            .p_diag_hold    = g_th_mem.diag_hold,
+        #endif
+    },
+    .p_coef         = g_th_coef,
+    .p_adc_ch       = g_th_mem.adc_ch,
+    .p_div          = g_th_mem.div,
+    .p_cnt          = g_th_mem.cnt,
+    .num_of         = eTH_NUM_OF,
+    .is_init        = false,
+
+    #if ( 1 == TH_FILTER_EN )
+        .lpf        =
+        {
+            .p_fc   = g_th_mem.lpf_fc,
+            .p_k    = g_th_mem.lpf_k,
+
+            #if ( 1 == TH_FIXED_POINT_EN )
+                .p_y    = g_th_mem.lpf_y,
+            #endif
+        },
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        .os         =
+        {
+            .p_acc      = g_th_mem.os_acc,
+            .p_cnt      = g_th_mem.os_cnt,
+            .p_ratio    = g_th_mem.os_ratio,
+            .p_shift    = g_th_mem.os_shift,
+        },
+    #endif
+
+    #if ( 1 == TH_MEDIAN_EN )
+        .med        =
+        {
+            .p_hist     = &g_th_mem.med_hist[0][0],
+            .p_idx      = g_th_mem.med_idx,
+            .p_win      = g_th_mem.med_win,
+        },
+    #endif
+
+    #if ( 1 == TH_LUT_EN )
+        .pp_lut     = gp_lut,
+
+        #if ( 0 == TH_LUT_IN_FLASH )
+            .p_lut_mem  = &g_th_lut[0][0],
+        #else
+            .p_lut_mem  = NULL,
+        #endif
+    #endif
+
+    #if ( 1 == TH_NTC_TAB_EN )
+        .p_ntc_seg      = g_th_ntc_seg,
+        .ntc_seg_size   = TH_NTC_TAB_POOL_SIZE,
+    #endif
+
+    #if ( 1 == TH_SNAPSHOT_EN )
+        .pub        =
+        {
+            [0] =
+            {
+                .p_raw          = g_th_mem.pub_raw[0],
+                .p_res          = g_th_mem.pub_res[0],
+                .p_temp         = g_th_mem.pub_temp[0],
+                .p_temp_filt    = g_th_mem.pub_temp_filt[0],
+                .p_status       = g_th_mem.pub_status[0],
+
+                #if ( 1 == TH_ALARM_EN )
+                    .p_alarm    = g_th_mem.pub_alarm[0],
+                #endif
+            },
+            [1] =
+            {
+                .p_raw          = g_th_mem.pub_raw[1],
+                .p_res          = g_th_mem.pub_res[1],
+                .p_temp         = g_th_mem.pub_temp[1],
+                .p_temp_filt    = g_th_mem.pub_temp_filt[1],
+                .p_status       = g_th_mem.pub_status[1],
+
+                #if ( 1 == TH_ALARM_EN )
+                    .p_alarm    = g_th_mem.pub_alarm[1],
+                #endif
+            },
+        },
+    #endif
+
+    #if ( 1 == TH_EVENT_EN )
+        .evt        =
+        {
+            .p_status   = g_th_mem.evt_status,
+
+            #if ( 1 == TH_ALARM_EN )
+                .p_alarm    = g_th_mem.evt_alarm,
+            #endif
+
+            .p_thr      = g_th_mem.evt_thr,
+            .p_thr_clr  = g_th_mem.evt_thr_clr,
+            .p_above    = g_th_mem.evt_above,
+            .pf_cb      = NULL,
+        },
+    #endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static float32_t    th_calc_res_low_side        (const th_coef_t * const p_coef, const uint16_t raw);
+static float32_t    th_calc_res_high_side       (const th_coef_t * const p_coef, const uint16_t raw);
+static float32_t    th_calc_res_both_pull       (const th_coef_t * const p_coef, const uint16_t raw);
+static inline float32_t th_calc_resistance      (const th_coef_t * const p_coef, const uint16_t raw);
+static float32_t    th_calc_ntc_temperature     (const th_coef_t * const p_coef, const float32_t rth);
+static float32_t    th_calc_ntc_sh_temperature  (const th_coef_t * const p_coef, const float32_t rth);
+static float32_t    th_calc_pt_temperature      (const th_coef_t * const p_coef, const float32_t rth);
+static inline float32_t th_calc_temperature     (const th_coef_t * const p_coef, const float32_t rth);
+static th_temp_t    th_conv_raw_to_temperature  (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+static void         th_init_coef                (const th_cfg_t * const p_cfg, th_coef_t * const p_coef);
+static void         th_init_limit               (th_ctx_t * const p_ctx, const uint32_t th);
+static void         th_status_hndl              (th_ctx_t * const p_ctx);
+
+#if ( 1 == TH_ALARM_EN )
+    static void     th_init_alarm               (th_ctx_t * const p_ctx, const uint32_t th);
+    static void     th_alarm_hndl               (th_ctx_t * const p_ctx);
+    static void     th_alarm_copy_mask          (const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg);
+#endif
+
+static void         th_process                  (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+static inline void  th_sample                   (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+
+#if ( 1 == TH_DIAG_EN )
+    static inline void th_diag_hndl             (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw_prev, const th_temp_t temp_prev);
+#endif
+
+static void         th_sched_init               (th_ctx_t * const p_ctx);
+static inline bool  th_sched_is_due             (th_ctx_t * const p_ctx, const uint32_t th);
+static inline uint32_t th_calc_div              (const float32_t period);
+static inline uint32_t th_calc_os_ratio         (const th_cfg_t * const p_cfg);
+static inline uint32_t th_calc_log2             (const uint32_t val);
+static void         th_pub_write                (th_ctx_t * const p_ctx);
+static inline th_pub_t th_pub_get              (const th_data_t * const p_data, const uint32_t th);
+static void         th_pub_read_with            (th_ctx_t * const p_ctx, const pf_th_pub_copy_t pf_copy, void * const p_arg);
+static th_pub_t     th_pub_read                 (th_ctx_t * const p_ctx, const uint32_t th);
+static void         th_pub_copy_one             (const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg);
+static void         th_pub_copy_all             (const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg);
+static void         th_pub_pack                 (const uint32_t th, const th_pub_t * const p_pub, th_sample_t * const p_sample, uint32_t * const p_fault);
+static inline void  th_pub_pack_res             (const th_ctx_t * const p_ctx, const uint32_t th, th_sample_t * const p_sample);
+static bool         th_check_cfg                (const th_cfg_t * const p_cfg);
+static bool         th_check_ntc_tab            (const th_cfg_t * const p_cfg);
+static bool         th_check_oversample         (const th_cfg_t * const p_cfg);
+static bool         th_check_median             (const th_cfg_t * const p_cfg);
+static th_status_t  th_check_cfg_table          (const th_cfg_t * const p_cfg, const uint32_t num_of);
+static void *       th_ctx_take                 (uint8_t * const p_mem, uint32_t * const p_size, const uint32_t size);
+static uint32_t     th_ctx_layout               (const th_cfg_t * const p_cfg, const uint32_t num_of, th_ctx_t * const p_ctx);
+static th_status_t  th_ctx_start                (th_ctx_t * const p_ctx);
+
+#if ( 1 == TH_LUT_EN )
+    static th_status_t  th_lut_init             (th_ctx_t * const p_ctx);
+    static th_temp_t    th_lut_get_temperature  (const th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+#endif
+
+#if ( 1 == TH_FILTER_EN )
+    static void             th_lpf_init         (th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp);
+    static void             th_lpf_set_fc       (th_ctx_t * const p_ctx, const uint32_t th, const float32_t fc);
+    static void             th_lpf_reset        (th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp);
+    static inline th_temp_t th_lpf_hndl         (th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp);
+#endif
+
+#if ( 1 == TH_OVERSAMPLE_EN )
+    static void         th_os_init              (th_ctx_t * const p_ctx, const uint32_t th);
+#endif
+
+#if ( 1 == TH_MEDIAN_EN )
+    static void             th_med_init         (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+    static inline uint16_t  th_med_hndl         (th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw);
+#endif
+
+#if ( 1 == TH_PERF_EN )
+    static void             th_perf_reset       (th_ctx_t * const p_ctx);
+    static inline void      th_perf_add         (th_perf_t * const p_perf, const uint32_t time);
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+    static void         th_evt_init             (th_ctx_t * const p_ctx);
+    static void         th_evt_hndl             (th_ctx_t * const p_ctx);
+    static void         th_evt_put              (th_ctx_t * const p_ctx, const uint32_t th, const th_evt_type_t type);
+#endif
+
+#if ( 1 == TH_NTC_TAB_EN )
+    static th_status_t  th_ntc_tab_init             (th_ctx_t * const p_ctx);
+    static float32_t    th_calc_ntc_tab_temperature (const th_coef_t * const p_coef, const float32_t rth);
+#endif
+
+static void         th_batch_calc_res           (const th_cfg_t * const p_cfg, const th_coef_t * const p_coef, const uint16_t * const p_raw, float32_t * const p_res, const uint32_t size);
+static void         th_batch_calc_temp          (const th_cfg_t * const p_cfg, const th_coef_t * const p_coef, float32_t * const p_temp, const uint32_t size);
+
+static inline float32_t th_limit_f32            (const float32_t in, const float32_t min, const float32_t max);
+static inline float32_t th_fast_logf            (const float32_t x);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Process new RAW ADC sample of thermistor
+*
+* @note     Converts sample to temperature and updates filter. Status
+*           is checked afterwards for all thermistors at once.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @param[in]    raw     - RAW ADC code
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_process(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+{
+    const th_data_t * const p_data = &p_ctx->data;
+
+    // Previous sample for diagnostics
+    #if ( 1 == TH_DIAG_EN )
+        const uint16_t  raw_prev    = p_data->p_raw[th];
+        const th_temp_t temp_prev   = p_data->p_temp[th];
+    #endif
+
+    p_data->p_raw[th] = raw;
+
+    // Get temperature
+    p_data->p_temp[th] = th_conv_raw_to_temperature( p_ctx, th, raw );
+
+    // Update filter
+    #if ( 1 == TH_FILTER_EN )
+        p_data->p_temp_filt[th] = th_lpf_hndl( p_ctx, th, p_data->p_temp[th] );
+    #else
+        p_data->p_temp_filt[th] = p_data->p_temp[th];
+    #endif
+
+    // Diagnose sensor against previous sample
+    #if ( 1 == TH_DIAG_EN )
+        th_diag_hndl( p_ctx, th, raw_prev, temp_prev );
+    #endif
+
+    // Mark for status debounce
+    p_ctx->limit.p_is_new[th] = 1U;
+}
+
+#if ( 1 == TH_DIAG_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Diagnose new sample of thermistor
+    *
+    * @note     Compares new sample with previous one, so that faults 
+    *           of sensor that reads plausible temperature are detected
+    *           with constant work per sample:
+    *
+    *           - eTH_ERROR_RATE: temperature changed by more than 
+    *             "rate_max" since previous sample
+    *           - eTH_ERROR_STUCK: RAW ADC code unchanged for "stuck_max"
+    *             consecutive samples
+    *
+    *           Detected fault is held as status candidate for "debounce" 
+    *           new samples since last detection, so that rate spike, 
+    *           which lasts at most two samples, can be confirmed by 
+    *           status debounce as any other status change.
+    *
+    * @param[in]    p_ctx       - Thermistor context
+    * @param[in]    th          - Thermistor index
+    * @param[in]    raw_prev    - Previous RAW ADC code
+    * @param[in]    temp_prev   - Previous temperature
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline void th_diag_hndl(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw_prev, const th_temp_t temp_prev)
+    {
+        const th_limit_t * const    p_limit     = &p_ctx->limit;
+        const th_temp_t             delta       = ( p_ctx->data.p_temp[th] - temp_prev );
+        const th_temp_t             delta_abs   = ( delta < 0 ) ? -delta : delta;
+        const uint32_t              stuck_max   = p_limit->p_stuck_max[th];
+        uint32_t                    stuck_cnt   = p_limit->p_stuck_cnt[th];
+        th_status_t                 status      = eTH_OK;
+
+        // Count consecutive unchanged codes, saturated at limit
+        if ( p_ctx->data.p_raw[th] == raw_prev )
+        {
+            stuck_cnt = ( stuck_cnt < stuck_max ) ? ( stuck_cnt + 1U ) : stuck_cnt;
+        }
+        else
+        {
+            stuck_cnt = 0U;
+        }
+
+        status = ( delta_abs > p_limit->p_rate_max[th] ) ? eTH_ERROR_RATE : status;
+        status = (( stuck_max > 0U ) && ( stuck_cnt >= stuck_max )) ? eTH_ERROR_STUCK : status;
+
+        p_limit->p_stuck_cnt[th] = stuck_cnt;
+
+        // Hold detected fault for debounce, at least until next status check
+        if ( eTH_OK != status )
+        {
+            const uint32_t deb = p_limit->p_debounce[th];
+
+            p_limit->p_status_diag[th]  = status;
+            p_limit->p_diag_hold[th]    = ( deb > 0U ) ? deb : 1U;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Take new RAW ADC sample of thermistor
+*
+* @note     With TH_MEDIAN_EN sample is first replaced by median of 
+*           last samples. With TH_OVERSAMPLE_EN samples are then 
+*           accumulated and only decimated sample is processed. 
+*           Decimated ADC code has half of log2(ratio) additional bits.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @param[in]    raw     - RAW ADC code
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void th_sample(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+{
+    #if ( 1 == TH_MEDIAN_EN )
+        const uint16_t raw_med = th_med_hndl( p_ctx, th, raw );
+    #else
+        const uint16_t raw_med = raw;
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+
+        const th_os_t * const p_os = &p_ctx->os;
+
+        p_os->p_acc[th] += raw_med;
+
+        // Decimate
+        if ( 0U == p_os->p_cnt[th] )
+        {
+            const uint16_t raw_dec = (uint16_t) ( p_os->p_acc[th] >> p_os->p_shift[th] );
+
+            p_os->p_acc[th] = 0U;
+            p_os->p_cnt[th] = ( p_os->p_ratio[th] - 1U );
+
+            th_process( p_ctx, th, raw_dec );
+        }
+        else
+        {
+            p_os->p_cnt[th]--;
+        }
+
+    #else
+        th_process( p_ctx, th, raw_med );
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Init update scheduler
+*
+* @note     Channels with the same update period are spread round-robin
+*           across handler calls, so that number of conversions per call
+*           stays as flat as possible.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_sched_init(th_ctx_t * const p_ctx)
+{
+    for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+    {
+        uint32_t same = 0U;
+
+        // Count previous channels with same period
+        for ( uint32_t i = 0; i < th; i++ )
+        {
+            if ( p_ctx->p_div[i] == p_ctx->p_div[th] )
+            {
+                same++;
+            }
+        }
+
+        p_ctx->p_cnt[th] = ( same % p_ctx->p_div[th] );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check if thermistor update is due at this handler call
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @return       is_due  - True if thermistor shall be updated
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool th_sched_is_due(th_ctx_t * const p_ctx, const uint32_t th)
+{
+    bool is_due = false;
+
+    if ( 0U == p_ctx->p_cnt[th] )
+    {
+        p_ctx->p_cnt[th] = ( p_ctx->p_div[th] - 1U );
+        is_due = true;
+    }
+    else
+    {
+        p_ctx->p_cnt[th]--;
+    }
+
+    return is_due;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate number of handler calls per update period
+*
+* @param[in]    period  - Update period in seconds, 0 for every handler call
+* @return       div     - Handler calls per update, at least 1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t th_calc_div(const float32_t period)
+{
+    uint32_t div = 1U;
+
+    if ( period > TH_HNDL_PERIOD_S )
+    {
+        div = (uint32_t) lroundf( period / TH_HNDL_PERIOD_S );
+    }
+
+    return div;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Get oversampling ratio of thermistor
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @return       ratio   - Samples per conversion, at least 1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t th_calc_os_ratio(const th_cfg_t * const p_cfg)
+{
+    uint32_t ratio = 1U;
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        if ( p_cfg->oversample > 1U )
+        {
+            ratio = p_cfg->oversample;
+        }
+    #else
+        (void) p_cfg;
+    #endif
+
+    return ratio;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate base 2 logarithm, rounded up
+*
+* @param[in]    val     - Input value
+* @return       log2    - Smallest n, where 2^n >= val
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t th_calc_log2(const uint32_t val)
+{
+    uint32_t log2 = 0U;
+
+    while (( 1UL << log2 ) < val )
+    {
+        log2++;
+    }
+
+    return log2;
+}
+
+#if ( 1 == TH_FILTER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init low pass filter
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    temp    - Initial temperature in internal units
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_lpf_init(th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp)
+    {
+        th_lpf_set_fc( p_ctx, th, p_ctx->p_cfg[th].lpf_fc );
+        th_lpf_reset( p_ctx, th, temp );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Set low pass filter cutoff frequency
+    *
+    * @note     Coefficient is exact step response match of first order RC
+    *           filter at update rate of thermistor: k = 1 - exp(-2*pi*fc/fs).
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    fc      - Cutoff frequency in Hz
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_lpf_set_fc(th_ctx_t * const p_ctx, const uint32_t th, const float32_t fc)
+    {
+        const float32_t fs  = ( TH_HNDL_FREQ_HZ / (float32_t) ( p_ctx->p_div[th] * th_calc_os_ratio( &p_ctx->p_cfg[th] )));
+        const float32_t k   = ( 1.0f - expf( -2.0f * 3.14159265f * fc / fs ));
+
+        p_ctx->lpf.p_fc[th] = fc;
+
+        #if ( 1 == TH_FIXED_POINT_EN )
+
+            // Smallest coefficient still moves filter
+            int32_t k_fix = (int32_t) lroundf( k * (float32_t) ( 1L << TH_LPF_K_FRAC_BITS ));
+            k_fix = ( k_fix < 1L ) ? 1L : k_fix;
+
+            p_ctx->lpf.p_k[th] = k_fix;
+
+        #else
+            p_ctx->lpf.p_k[th] = k;
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Reset low pass filter to temperature
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    temp    - Temperature in internal units
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_lpf_reset(th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp)
+    {
+        #if ( 1 == TH_FIXED_POINT_EN )
+            p_ctx->lpf.p_y[th] = ( temp * ( 1L << TH_LPF_Y_FRAC_BITS ));
+        #endif
+
+        p_ctx->data.p_temp_filt[th] = temp;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Update low pass filter with new temperature
+    *
+    * @param[in]    p_ctx       - Thermistor context
+    * @param[in]    th          - Thermistor index
+    * @param[in]    temp        - Temperature in internal units
+    * @return       temp_filt   - Filtered temperature in internal units
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline th_temp_t th_lpf_hndl(th_ctx_t * const p_ctx, const uint32_t th, const th_temp_t temp)
+    {
+        th_temp_t temp_filt = 0;
+
+        #if ( 1 == TH_FIXED_POINT_EN )
+
+            int32_t y = p_ctx->lpf.p_y[th];
+
+            y += (int32_t) (((( (int64_t) temp * ( 1L << TH_LPF_Y_FRAC_BITS )) - y ) * p_ctx->lpf.p_k[th] ) >> TH_LPF_K_FRAC_BITS );
+            p_ctx->lpf.p_y[th] = y;
+
+            // Round to milli degC
+            temp_filt = (th_temp_t) (( y + ( 1L << ( TH_LPF_Y_FRAC_BITS - 1 ))) >> TH_LPF_Y_FRAC_BITS );
+
+        #else
+
+            // State is last filtered temperature
+            temp_filt = p_ctx->data.p_temp_filt[th];
+            temp_filt += ( p_ctx->lpf.p_k[th] * ( temp - temp_filt ));
+
+        #endif
+
+        return temp_filt;
+    }
+
+#endif
+
+#if ( 1 == TH_OVERSAMPLE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init oversampling
+    *
+    * @note     Each 4 times oversampling adds single bit of resolution.
+    *           Decimated ADC code is accumulator shifted right by 
+    *           log2(ratio) - bits, thus thermistor coefficients are 
+    *           scaled by 2^bits to decimated ADC code.
+    *
+    *           Must be called after th_init_coef()!
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_os_init(th_ctx_t * const p_ctx, const uint32_t th)
+    {
+        th_coef_t * const   p_coef  = &p_ctx->p_coef[th];
+        const uint32_t      ratio   = th_calc_os_ratio( &p_ctx->p_cfg[th] );
+        const uint32_t      log2    = th_calc_log2( ratio );
+        const uint32_t      bits    = ( log2 / 2U );
+
+        p_ctx->os.p_acc[th]     = 0U;
+        p_ctx->os.p_cnt[th]     = ( ratio - 1U );
+        p_ctx->os.p_ratio[th]   = ratio;
+        p_ctx->os.p_shift[th]   = ( log2 - bits );
+
+        p_coef->os_bits  = bits;
+        p_coef->raw_max *= (float32_t) ( 1UL << bits );
+        p_coef->raw_lsb  = (float32_t) ( 1UL << bits );
+        p_coef->both_n0 *= (float32_t) ( 1UL << bits );
+        p_coef->both_d0 *= (float32_t) ( 1UL << bits );
+    }
+
+#endif
+
+#if ( 1 == TH_MEDIAN_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init median pre-filter
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    raw     - Initial RAW ADC code
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_med_init(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+    {
+        uint16_t * const p_hist = &p_ctx->med.p_hist[ th * TH_MEDIAN_HIST_SIZE ];
+
+        p_ctx->med.p_win[th] = ( p_ctx->p_cfg[th].median > 1U ) ? p_ctx->p_cfg[th].median : 1U;
+        p_ctx->med.p_idx[th] = 0U;
+
+        for ( uint32_t i = 0; i < TH_MEDIAN_HIST_SIZE; i++ )
+        {
+            p_hist[i] = raw;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Update median pre-filter with new RAW ADC code
+    *
+    * @note     Median is selected by optimal sorting networks of 3, 7 and
+    *           13 compare-swaps for window of 3, 5 and 7 samples, thus in
+    *           constant time and without branches on sample values. 
+    *           Filter delays signal by half of window.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    raw     - RAW ADC code
+    * @return       raw_med - Median of last RAW ADC codes
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline uint16_t th_med_hndl(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+    {
+        const th_med_t * const  p_med   = &p_ctx->med;
+        uint16_t * const        p_hist  = &p_med->p_hist[ th * TH_MEDIAN_HIST_SIZE ];
+        const uint32_t          win     = p_med->p_win[th];
+        const uint32_t          idx     = p_med->p_idx[th];
+        uint16_t                v[TH_MEDIAN_WIN_MAX];
+        uint16_t                raw_med = raw;
+
+        // Replace oldest sample
+        p_hist[idx] = raw;
+        p_med->p_idx[th] = (( idx + 1U ) < win ) ? ( idx + 1U ) : 0U;
+
+        // NOTE: Order of samples in window does not matter
+        memcpy( v, p_hist, sizeof( v ));
+
+        switch( win )
+        {
+            case 3U:
+                TH_SORT2( v[0], v[1] ); TH_SORT2( v[1], v[2] ); TH_SORT2( v[0], v[1] );
+                raw_med = v[1];
+                break;
+
+            case 5U:
+                TH_SORT2( v[0], v[1] ); TH_SORT2( v[3], v[4] ); TH_SORT2( v[0], v[3] );
+                TH_SORT2( v[1], v[4] ); TH_SORT2( v[1], v[2] ); TH_SORT2( v[2], v[3] );
+                TH_SORT2( v[1], v[2] );
+                raw_med = v[2];
+                break;
+
+            case 7U:
+                TH_SORT2( v[0], v[5] ); TH_SORT2( v[0], v[3] ); TH_SORT2( v[1], v[6] );
+                TH_SORT2( v[2], v[4] ); TH_SORT2( v[0], v[1] ); TH_SORT2( v[3], v[5] );
+                TH_SORT2( v[2], v[6] ); TH_SORT2( v[2], v[3] ); TH_SORT2( v[3], v[6] );
+                TH_SORT2( v[4], v[5] ); TH_SORT2( v[1], v[4] ); TH_SORT2( v[1], v[3] );
+                TH_SORT2( v[3], v[4] );
+                raw_med = v[3];
+                break;
+
+            // No filter
+            default:
+                break;
+        }
+
+        return raw_med;
+    }
+
+#endif
+
+#if ( 1 == TH_PERF_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Reset execution time statistics
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_perf_reset(th_ctx_t * const p_ctx)
+    {
+        memset( p_ctx->perf, 0, sizeof( p_ctx->perf ));
+
+        for ( uint32_t id = 0; id < eTH_PERF_NUM_OF; id++ )
+        {
+            p_ctx->perf[id].min = UINT32_MAX;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Add execution time to statistics
+    *
+    * @param[in]    p_perf  - Execution time statistics
+    * @param[in]    time    - Execution time in TH_GET_TIMESTAMP() ticks
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static inline void th_perf_add(th_perf_t * const p_perf, const uint32_t time)
+    {
+        uint32_t bin = 0U;
+
+        // Log2 histogram bin
+        while (( bin < ( TH_PERF_HIST_SIZE - 1U )) && (( time >> ( bin + 1U )) > 0U ))
+        {
+            bin++;
+        }
+
+        p_perf->sum += time;
+        p_perf->cnt++;
+        p_perf->min = ( time < p_perf->min ) ? time : p_perf->min;
+        p_perf->max = ( time > p_perf->max ) ? time : p_perf->max;
+        p_perf->hist[bin]++;
+    }
+
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init events
+    *
+    * @note     Takes current status, alarms and threshold side as reported,
+    *           so that no event is generated at init, and empties queue.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_evt_init(th_ctx_t * const p_ctx)
+    {
+        th_evt_t * const p_evt = &p_ctx->evt;
+
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            const th_cfg_t * const p_cfg = &p_ctx->p_cfg[th];
+
+            if ( true == p_cfg->thr.en )
+            {
+                p_evt->p_thr[th]        = TH_DEGC_TO_TEMP( p_cfg->thr.temp );
+                p_evt->p_thr_clr[th]    = TH_DEGC_TO_TEMP( p_cfg->thr.temp - p_cfg->thr.hyst );
+            }
+            else
+            {
+                p_evt->p_thr[th]        = TH_TEMP_MAX;
+                p_evt->p_thr_clr[th]    = TH_TEMP_MAX;
+            }
+
+            p_evt->p_status[th] = p_ctx->data.p_status[th];
+            p_evt->p_above[th]  = ( p_ctx->data.p_temp_filt[th] > p_evt->p_thr[th] ) ? 1U : 0U;
+
+            #if ( 1 == TH_ALARM_EN )
+                p_evt->p_alarm[th] = p_ctx->data.p_alarm[th];
+            #endif
+        }
+
+        atomic_store_explicit( &p_evt->wr, 0U, memory_order_relaxed );
+        atomic_store_explicit( &p_evt->rd, 0U, memory_order_relaxed );
+        p_evt->lost = 0U;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Handle events of all thermistors
+    *
+    * @note     Events are rare, therefore single pass over all thermistors
+    *           compares status, alarms and threshold side with last 
+    *           reported ones and branches only on change.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_evt_hndl(th_ctx_t * const p_ctx)
+    {
+        const th_evt_t * const      p_evt       = &p_ctx->evt;
+        const th_temp_t * const     p_temp      = p_ctx->data.p_temp_filt;
+        const th_status_t * const   p_status    = p_ctx->data.p_status;
+        const uint32_t              num_of      = p_ctx->num_of;
+
+        #if ( 1 == TH_ALARM_EN )
+            const uint32_t * const  p_alarm     = p_ctx->data.p_alarm;
+        #endif
+
+        for ( uint32_t th = 0; th < num_of; th++ )
+        {
+            const th_status_t   status      = p_status[th];
+            const th_status_t   prev        = p_evt->p_status[th];
+            const uint32_t      was_above   = p_evt->p_above[th];
+
+            // Above threshold, stays above until it falls bellow hysteresis
+            const th_temp_t     thr         = ( 0U != was_above ) ? p_evt->p_thr_clr[th] : p_evt->p_thr[th];
+            const uint32_t      above       = ( p_temp[th] > thr ) ? 1U : 0U;
+
+            if ( status != prev )
+            {
+                th_evt_put( p_ctx, th, eTH_EVT_STATUS );
+                p_evt->p_status[th] = status;
+            }
+
+            #if ( 1 == TH_ALARM_EN )
+                if ( p_alarm[th] != p_evt->p_alarm[th] )
+                {
+                    th_evt_put( p_ctx, th, eTH_EVT_ALARM );
+                    p_evt->p_alarm[th] = p_alarm[th];
+                }
+            #endif
+
+            if ( above != was_above )
+            {
+                th_evt_put( p_ctx, th, (( 0U != above ) ? eTH_EVT_THR_ABOVE : eTH_EVT_THR_BELOW ));
+                p_evt->p_above[th] = above;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Put thermistor event into queue and report it to callback
+    *
+    * @note     Event is queued before callback is called, so that consumer
+    *           woken up by callback finds it in queue. When queue is full
+    *           event is dropped without callback and counted in next 
+    *           queued event.
+    *
+    *           Shall be called before last reported values are updated.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    type    - Event type
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_evt_put(th_ctx_t * const p_ctx, const uint32_t th, const th_evt_type_t type)
+    {
+        th_evt_t * const    p_evt   = &p_ctx->evt;
+        const uint32_t      wr      = atomic_load_explicit( &p_evt->wr, memory_order_relaxed );
+        const uint32_t      rd      = atomic_load_explicit( &p_evt->rd, memory_order_acquire );
+        th_event_t          event   = {0};
+
+        event.temp_filt = p_ctx->data.p_temp_filt[th];
+        event.th        = th;
+        event.type      = type;
+        event.status    = (uint8_t) p_ctx->data.p_status[th];
+        event.prev      = (uint8_t) p_evt->p_status[th];
+
+        #if ( 1 == TH_ALARM_EN )
+            event.alarm         = (uint8_t) p_ctx->data.p_alarm[th];
+            event.alarm_prev    = (uint8_t) p_evt->p_alarm[th];
+        #endif
+
+        if (( wr - rd ) < TH_EVENT_QUEUE_SIZE )
+        {
+            event.lost = p_evt->lost;
+            p_evt->lost = 0U;
+
+            p_evt->queue[ wr & ( TH_EVENT_QUEUE_SIZE - 1U ) ] = event;
+            atomic_store_explicit( &p_evt->wr, ( wr + 1U ), memory_order_release );
+
+            if ( NULL != p_evt->pf_cb )
+            {
+                p_evt->pf_cb( &event );
+            }
+        }
+        else
+        {
+            p_evt->lost++;
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Publish data of all thermistors
+*
+* @note     With TH_SNAPSHOT_EN data is copied into back buffer, which
+*           then becomes front by incrementing sequence counter. Reader
+*           of front buffer is therefore never disturbed by handler 
+*           until next publish. Handler of context shall be called from 
+*           single thread only.
+*
+*           Back buffer was front two publishes ago, so release fence
+*           orders copy after previous sequence counter store. Reader 
+*           that sees any new value then sees changed sequence counter
+*           after its acquire fence and repeats the read.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_pub_write(th_ctx_t * const p_ctx)
+{
+    #if ( 1 == TH_SNAPSHOT_EN )
+
+        const uint32_t          seq     = atomic_load_explicit( &p_ctx->pub_seq, memory_order_relaxed );
+        const th_data_t * const p_back  = &p_ctx->pub[( seq + 1U ) & 1U];
+        const uint32_t          num_of  = p_ctx->num_of;
+
+        // Copy stays after previous publish on weakly ordered cores
+        atomic_thread_fence( memory_order_release );
+
+        // Block copy of each value
+        memcpy( p_back->p_raw,          p_ctx->data.p_raw,          ( num_of * sizeof( uint16_t )));
+        memcpy( p_back->p_res,          p_ctx->data.p_res,          ( num_of * sizeof( float32_t )));
+        memcpy( p_back->p_temp,         p_ctx->data.p_temp,         ( num_of * sizeof( th_temp_t )));
+        memcpy( p_back->p_temp_filt,    p_ctx->data.p_temp_filt,    ( num_of * sizeof( th_temp_t )));
+        memcpy( p_back->p_status,       p_ctx->data.p_status,       ( num_of * sizeof( th_status_t )));
+
+        #if ( 1 == TH_ALARM_EN )
+            memcpy( p_back->p_alarm,    p_ctx->data.p_alarm,        ( num_of * sizeof( uint32_t )));
+        #endif
+
+        // Swap buffers
+        atomic_store_explicit( &p_ctx->pub_seq, ( seq + 1U ), memory_order_release );
+
+    #else
+
+        // Getters read thermistor data directly
+        (void) p_ctx;
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Read published thermistor data with copy function
+*
+* @note     With TH_SNAPSHOT_EN front buffer is copied and read is 
+*           repeated if handler published in the meantime. Handler
+*           never waits on reader. All readers of published data go 
+*           through this function.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    pf_copy - Copy function of published data
+* @param[out]   p_arg   - Destination of copy
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_pub_read_with(th_ctx_t * const p_ctx, const pf_th_pub_copy_t pf_copy, void * const p_arg)
+{
+    #if ( 1 == TH_SNAPSHOT_EN )
+
+        uint32_t seq = 0U;
+
+        do
+        {
+            seq = atomic_load_explicit( &p_ctx->pub_seq, memory_order_acquire );
+            pf_copy( p_ctx, &p_ctx->pub[seq & 1U], p_arg );
+            atomic_thread_fence( memory_order_acquire );
+        }
+        while ( seq != atomic_load_explicit( &p_ctx->pub_seq, memory_order_relaxed ));
+
+    #else
+        pf_copy( p_ctx, &p_ctx->data, p_arg );
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Read published data of single thermistor
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @return       pub     - Published thermistor data
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_pub_t th_pub_read(th_ctx_t * const p_ctx, const uint32_t th)
+{
+    th_pub_one_t one = { .th = th };
+
+    th_pub_read_with( p_ctx, th_pub_copy_one, &one );
+
+    return one.pub;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Copy published data of single thermistor
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    p_data  - Published thermistor data
+* @param[out]   p_arg   - Copy of single thermistor, th_pub_one_t
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_pub_copy_one(const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg)
+{
+    th_pub_one_t * const p_one = (th_pub_one_t*) p_arg;
+
+    (void) p_ctx;
+
+    p_one->pub = th_pub_get( p_data, p_one->th );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Copy published data of all thermistors into samples
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    p_data  - Published thermistor data
+* @param[out]   p_arg   - Samples and fault mask, th_pub_all_t
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_pub_copy_all(const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg)
+{
+    const th_pub_all_t * const  p_all       = (const th_pub_all_t*) p_arg;
+    const uint32_t              fault_words = TH_FAULT_MASK_WORDS_OF( p_ctx->num_of );
+
+    for ( uint32_t w = 0; ( NULL != p_all->p_fault ) && ( w < fault_words ); w++ )
+    {
+        p_all->p_fault[w] = 0U;
+    }
+
+    for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+    {
+        const th_pub_t pub = th_pub_get( p_data, th );
+
+        th_pub_pack( th, &pub, &p_all->p_samples[th], p_all->p_fault );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Gather values of single thermistor from thermistor data
+*
+* @param[in]    p_data  - Thermistor data
+* @param[in]    th      - Thermistor index
+* @return       pub     - Values of thermistor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline th_pub_t th_pub_get(const th_data_t * const p_data, const uint32_t th)
+{
+    th_pub_t pub = {0};
+
+    pub.raw         = p_data->p_raw[th];
+    pub.res         = p_data->p_res[th];
+    pub.temp        = p_data->p_temp[th];
+    pub.temp_filt   = p_data->p_temp_filt[th];
+    pub.status      = p_data->p_status[th];
+
+    #if ( 1 == TH_ALARM_EN )
+        pub.alarm   = p_data->p_alarm[th];
+    #endif
+
+    return pub;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Pack published thermistor data into sample
+*
+* @note     Resistance is completed by th_pub_pack_res() after read of
+*           published data.
+*
+* @param[in]    th          - Thermistor index
+* @param[in]    p_pub       - Published thermistor data
+* @param[out]   p_sample    - Thermistor sample
+* @param[out]   p_fault     - Fault mask, thermistor bit is set on fault, can be NULL
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_pub_pack(const uint32_t th, const th_pub_t * const p_pub, th_sample_t * const p_sample, uint32_t * const p_fault)
+{
+    p_sample->temp      = p_pub->temp;
+    p_sample->temp_filt = p_pub->temp_filt;
+    p_sample->raw       = p_pub->raw;
+    p_sample->res       = p_pub->res;
+    p_sample->status    = (uint8_t) p_pub->status;
+
+    #if ( 1 == TH_ALARM_EN )
+        p_sample->alarm = (uint8_t) p_pub->alarm;
+    #endif
+
+    if  (   ( eTH_OK != p_pub->status )
+        &&  ( NULL != p_fault ))
+    {
+        p_fault[ th >> 5U ] |= ( 1UL << ( th & 31U ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Complete resistance of packed sample
+*
+* @note     Resistance is not part of look-up table conversion, so it
+*           is calculated from copied RAW ADC code. Called after read
+*           of published data, so that float division does not widen 
+*           snapshot read window.
+*
+* @param[in]    p_ctx       - Thermistor context
+* @param[in]    th          - Thermistor index
+* @param[out]   p_sample    - Thermistor sample
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void th_pub_pack_res(const th_ctx_t * const p_ctx, const uint32_t th, th_sample_t * const p_sample)
+{
+    #if ( 1 == TH_LUT_EN )
+        p_sample->res = th_calc_resistance( &p_ctx->p_coef[th], p_sample->raw );
+    #else
+        (void) p_ctx;
+        (void) th;
+        (void) p_sample;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate resistance of thermistor on low side with pull-up resistor
+*
+* @note     Rth = Rpu * Vth / ( Vcc - Vth )
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    raw     - RAW ADC code
+* @return       res     - Resistance of thermistor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_res_low_side(const th_coef_t * const p_coef, const uint16_t raw)
+{
+    float32_t       th_res  = 1e6f;                                 // ADC code at maximum means Rth is very high!
+    const float32_t adc     = ((float32_t) raw + p_coef->raw_lsb ); // +1 LSB to prevent dividing by zero!
+
+    if ( adc < p_coef->raw_max )
+    {
+        th_res = (float32_t) (( p_coef->pull * adc ) / ( p_coef->raw_max - adc ));
+    }
+    
+    return th_res;     
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate resistance of thermistor on high side with pull-down resistor
+*
+* @note     Rth = Rpd * ( Vcc - Vth ) / Vth
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    raw     - RAW ADC code
+* @return       res     - Resistance of thermistor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_res_high_side(const th_coef_t * const p_coef, const uint16_t raw)
+{
+    float32_t       th_res  = 0.0f;                                 // ADC code at maximum means Rth is 0 ohm!
+    const float32_t adc     = ((float32_t) raw + p_coef->raw_lsb ); // +1 LSB to prevent dividing by zero!
+
+    if ( adc < p_coef->raw_max )
+    {
+        th_res = (float32_t) (( p_coef->pull * ( p_coef->raw_max - adc )) / adc );
+    }
+    
+    return th_res;     
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate resistance of thermistor with both pull resistors
+*
+* @note     Thermistor on low side (Rpd parallel to thermistor):
+*
+*               Rth = adc / ( Gpu * ( max - adc ) - Gpd * adc )
+*
+*           Thermistor on high side (Rpu parallel to thermistor):
+*
+*               Rth = ( max - adc ) / ( Gpd * adc - Gpu * ( max - adc ))
+*
+*           where Gpu = 1/Rpu and Gpd = 1/Rpd. Both are folded at init into 
+*           Rth = ( n0 + n1 * adc ) / ( d0 + d1 * adc ). Non-positive
+*           denominator means open thermistor, negative numerator short 
+*           one, which is then limited to minimum resistance.
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    raw     - RAW ADC code
+* @return       res     - Resistance of thermistor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_res_both_pull(const th_coef_t * const p_coef, const uint16_t raw)
+{
+    float32_t       th_res  = 1e6f;                                 // Open thermistor means Rth is very high!
+    const float32_t adc     = ((float32_t) raw + p_coef->raw_lsb ); // +1 LSB to prevent dividing by zero!
+    const float32_t den     = ( p_coef->both_d0 + ( p_coef->both_d1 * adc ));
+
+    if ( den > 0.0f )
+    {
+        th_res = (( p_coef->both_n0 + ( p_coef->both_n1 * adc )) / den );
+    }
+    
+    return th_res;     
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate resistance of thermistor
+*
+* @note     Resistance is limited to sensor type range.
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    raw     - RAW ADC code
+* @return       res     - Resistance of thermistor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t th_calc_resistance(const th_coef_t * const p_coef, const uint16_t raw)
+{
+    return th_limit_f32( p_coef->pf_calc_res( p_coef, raw ), p_coef->res_min, p_coef->res_max );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Convert NTC resistance to degree C
+*
+* @note     1/T = 1/T25 + 1/beta * ln( rth / rth_nom ), where constant
+*           part is pre-calculated at init.
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    rth     - Resistance of NTC thermistor
+* @return       temp    - Calculated temperature
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_ntc_temperature(const th_coef_t * const p_coef, const float32_t rth)
+{
+    float32_t temp = 0.0f;
+
+    // Calculate temperature
+    temp = (float32_t) (( 1.0f / ( p_coef->ntc_k + ( p_coef->ntc_inv_beta * logf( rth )))) - 273.15f );
+
+    return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Convert NTC resistance to degree C with Steinhart-Hart model
+*
+* @note     1/T = A + B * ln( rth ) + C * ln( rth )^3
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    rth     - Resistance of NTC thermistor
+* @return       temp    - Calculated temperature
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_ntc_sh_temperature(const th_coef_t * const p_coef, const float32_t rth)
+{
+    float32_t       temp    = 0.0f;
+    const float32_t ln_rth  = logf( rth );
+
+    // Calculate temperature
+    temp = (float32_t) (( 1.0f / ( p_coef->ntc_k + ( ln_rth * ( p_coef->ntc_inv_beta + ( p_coef->ntc_c * ln_rth * ln_rth ))))) - 273.15f );
+
+    return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Convert PT100/500/1000 resistance to degree C
+*
+* @note     Calculation according to DIN EN60751 standard, scaled by
+*           nominal resistance R0. 
+*
+*           Above 0 degC equation is quadratic and solved exactly. Bellow 
+*           0 degC full Callendar-Van Dusen equation is used in form of 
+*           pre-calculated polynomial inverse, so no iteration is needed.
+*           For futher details look at table: doc/pt1000_pt100_pt500_tables.xlsx 
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    rth     - Resistance of PT thermistor
+* @return       temp    - Calculated temperature
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_calc_pt_temperature(const th_coef_t * const p_coef, const float32_t rth)
+{
+    float32_t       temp    = 0.0f;
+    const float32_t u       = (( rth * p_coef->pt_inv_r0 ) - 1.0f );
+
+    // Bellow 0 degC
+    if ( u < 0.0f )
+    {
+        temp = (((( TH_PT_CVD_NEG_C4 * u + TH_PT_CVD_NEG_C3 ) * u + TH_PT_CVD_NEG_C2 ) * u + TH_PT_CVD_NEG_C1 ) * u );
+    }
+
+    // At or above 0 degC
+    else
+    {
+        temp = (float32_t) (( -(float32_t) TH_PT_DIN_EN60751_A + sqrtf( TH_PT_DIN_EN60751_AA + TH_PT_DIN_EN60751_4B * u )) * TH_PT_DIN_EN60751_INV_2B );
+    }
+
+    return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Calculate temperature
+*
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    rth     - Resistance of thermistor
+* @return       temp    - Calculated temperature
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t th_calc_temperature(const th_coef_t * const p_coef, const float32_t rth)
+{
+    return p_coef->pf_calc_temp( p_coef, rth );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Convert RAW ADC code to temperature
+*
+* @note     Depending on TH_LUT_EN configuration temperature is either
+*           taken from look-up table or calculated from thermistor
+*           resistance. 
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @param[in]    raw     - RAW ADC code
+* @return       temp    - Calculated temperature in internal units
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_temp_t th_conv_raw_to_temperature(th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+{
+    th_temp_t temp = 0;
+
+    #if ( 1 == TH_PERF_EN )
+        const uint32_t start = (uint32_t) TH_GET_TIMESTAMP();
+    #endif
+
+    #if ( 1 == TH_LUT_EN )
+
+        // Resistance is calculated only on request
+        temp = th_lut_get_temperature( p_ctx, th, raw );
+
+        #if ( 1 == TH_PERF_EN )
+            th_perf_add( &p_ctx->perf[eTH_PERF_CONV_LUT], ((uint32_t) TH_GET_TIMESTAMP() - start ));
+        #endif
+
+    #else
+
+        // Calculate thermistor resistance
+        p_ctx->data.p_res[th] = th_calc_resistance( &p_ctx->p_coef[th], raw );
+
+        // Calculate temperature
+        temp = th_calc_temperature( &p_ctx->p_coef[th], p_ctx->data.p_res[th] );
+
+        #if ( 1 == TH_PERF_EN )
+            th_perf_add( &p_ctx->perf[ p_ctx->p_coef[th].perf_id ], ((uint32_t) TH_GET_TIMESTAMP() - start ));
+        #endif
+
+    #endif
+
+    return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Init thermistor pre-calculated coefficients
+*
+* @note     Configuration must be checked before!
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @param[out]   p_coef  - Thermistor coefficients
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_init_coef(const th_cfg_t * const p_cfg, th_coef_t * const p_coef)
+{
+    p_coef->raw_max = (float32_t) adc_get_raw_max();
+    p_coef->raw_lsb = 1.0f;
+
+    // Resistance calculation based on HW configuration
+    if ( eTH_HW_PULL_BOTH == p_cfg->hw.pull_mode )
+    {
+        const float32_t g_pu = ( 1.0f / p_cfg->hw.pull_up );
+        const float32_t g_pd = ( 1.0f / p_cfg->hw.pull_down );
+
+        p_coef->pf_calc_res = th_calc_res_both_pull;
+
+        // Rth = adc / (( Gpu * max ) - ( Gpu + Gpd ) * adc )
+        if ( eTH_HW_LOW_SIDE == p_cfg->hw.conn )
+        {
+            p_coef->both_n0 = 0.0f;
+            p_coef->both_n1 = 1.0f;
+            p_coef->both_d0 = ( g_pu * p_coef->raw_max );
+            p_coef->both_d1 = -( g_pu + g_pd );
+        }
+
+        // Rth = ( max - adc ) / (( Gpu + Gpd ) * adc - ( Gpu * max ))
+        else
+        {
+            p_coef->both_n0 = p_coef->raw_max;
+            p_coef->both_n1 = -1.0f;
+            p_coef->both_d0 = -( g_pu * p_coef->raw_max );
+            p_coef->both_d1 = ( g_pu + g_pd );
+        }
+    }
+    else if ( eTH_HW_LOW_SIDE == p_cfg->hw.conn )
+    {
+        p_coef->pf_calc_res = th_calc_res_low_side;
+        p_coef->pull        = p_cfg->hw.pull_up;
+    }
+    else
+    {
+        p_coef->pf_calc_res = th_calc_res_high_side;
+        p_coef->pull        = p_cfg->hw.pull_down;
+    }
+
+    // Temperature calculation and limits based on sensor type
+    switch( p_cfg->type )
+    {
+        case eTH_TYPE_NTC:
+            p_coef->pf_calc_temp    = th_calc_ntc_temperature;
+            p_coef->res_min         = 1.0f;
+            p_coef->res_max         = 10e6f;
+            p_coef->ntc_inv_beta    = ( 1.0f / p_cfg->ntc.beta );
+            p_coef->ntc_k           = ( TH_NTC_25DEG_FACTOR - ( p_coef->ntc_inv_beta * logf( p_cfg->ntc.nom_val )));
+            break;
+
+        case eTH_TYPE_NTC_SH:
+            p_coef->pf_calc_temp    = th_calc_ntc_sh_temperature;
+            p_coef->res_min         = 1.0f;
+            p_coef->res_max         = 10e6f;
+            p_coef->ntc_k           = p_cfg->ntc_sh.a;
+            p_coef->ntc_inv_beta    = p_cfg->ntc_sh.b;
+            p_coef->ntc_c           = p_cfg->ntc_sh.c;
+            break;
+
+        #if ( 1 == TH_NTC_TAB_EN )
+
+            // NOTE: Table points are pre-calculated by th_ntc_tab_init()
+            case eTH_TYPE_NTC_TAB:
+                p_coef->pf_calc_temp    = th_calc_ntc_tab_temperature;
+                p_coef->res_min         = 1.0f;
+                p_coef->res_max         = 10e6f;
+                break;
+
+        #endif
+
+        case eTH_TYPE_PT100:
+            p_coef->pf_calc_temp    = th_calc_pt_temperature;
+            p_coef->pt_inv_r0       = ( 1.0f / 100.0f );
+            p_coef->res_min         = TH_PT100_MIN_OHM;
+            p_coef->res_max         = TH_PT100_MAX_OHM;
+            break;
+
+        case eTH_TYPE_PT500:
+            p_coef->pf_calc_temp    = th_calc_pt_temperature;
+            p_coef->pt_inv_r0       = ( 1.0f / 500.0f );
+            p_coef->res_min         = TH_PT500_MIN_OHM;
+            p_coef->res_max         = TH_PT500_MAX_OHM;
+            break;
+
+        case eTH_TYPE_PT1000:
+            p_coef->pf_calc_temp    = th_calc_pt_temperature;
+            p_coef->pt_inv_r0       = ( 1.0f / 1000.0f );
+            p_coef->res_min         = TH_PT1000_MIN_OHM;
+            p_coef->res_max         = TH_PT1000_MAX_OHM;
+            break;
+
+        default:
+            TH_ASSERT( 0 );
+            break;
+    }
+
+    // Execution time statistics of conversion kernel
+    #if ( 1 == TH_PERF_EN )
+        p_coef->perf_id =   ( eTH_TYPE_NTC == p_cfg->type )     ? eTH_PERF_CONV_NTC
+                        :   ( eTH_TYPE_NTC_SH == p_cfg->type )  ? eTH_PERF_CONV_NTC_SH
+                        :   ( eTH_TYPE_NTC_TAB == p_cfg->type ) ? eTH_PERF_CONV_NTC_TAB
+                        :   eTH_PERF_CONV_PT;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Init thermistor scheduling and status limits
+*
+* @note     Configuration must be checked before!
+*
+* @param[in]    p_ctx   - Thermistor context
+* @param[in]    th      - Thermistor index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_init_limit(th_ctx_t * const p_ctx, const uint32_t th)
+{
+    const th_cfg_t * const  p_cfg   = &p_ctx->p_cfg[th];
+    const th_limit_t * const p_limit = &p_ctx->limit;
+
+    p_ctx->p_adc_ch[th] = p_cfg->adc_ch;
+
+    // Update rate divider
+    p_ctx->p_div[th] = th_calc_div( p_cfg->period );
+
+    // Valid range in internal units
+    p_limit->p_range_min[th]    = TH_DEGC_TO_TEMP( p_cfg->range.min );
+    p_limit->p_range_max[th]    = TH_DEGC_TO_TEMP( p_cfg->range.max );
+    p_limit->p_clear_min[th]    = TH_DEGC_TO_TEMP( p_cfg->range.min + p_cfg->range.hyst );
+    p_limit->p_clear_max[th]    = TH_DEGC_TO_TEMP( p_cfg->range.max - p_cfg->range.hyst );
+    p_limit->p_err_type[th]     = p_cfg->err_type;
+
+    // Status debounce
+    p_limit->p_debounce[th]     = p_cfg->range.debounce;
+    p_limit->p_deb_cand[th]     = eTH_OK;
+    p_limit->p_deb_cnt[th]      = 0U;
+    p_limit->p_is_new[th]       = 0U;
+
+    // Sensor diagnostics, rate of change limit per update period
+    #if ( 1 == TH_DIAG_EN )
+        const float32_t ts = ( TH_HNDL_PERIOD_S * (float32_t) ( p_ctx->p_div[th] * th_calc_os_ratio( p_cfg )));
+
+        p_limit->p_rate_max[th]     = ( p_cfg->diag.rate_max > 0.0f ) ? TH_DEGC_TO_TEMP( p_cfg->diag.rate_max * ts ) : TH_TEMP_MAX;
+        p_limit->p_stuck_max[th]    = p_cfg->diag.stuck;
+        p_limit->p_stuck_cnt[th]    = 0U;
+        p_limit->p_status_diag[th]  = eTH_OK;
+        p_limit->p_diag_hold[th]    = 0U;
+    #endif
+
+    // PT resistance increases with temperature, NTC decreases
+    if  (   ( eTH_TYPE_PT100 == p_cfg->type )
+        ||  ( eTH_TYPE_PT500 == p_cfg->type )
+        ||  ( eTH_TYPE_PT1000 == p_cfg->type ))
+    {
+        p_limit->p_status_min[th] = eTH_ERROR_SHORT;
+        p_limit->p_status_max[th] = eTH_ERROR_OPEN;
+    }
+    else
+    {
+        p_limit->p_status_min[th] = eTH_ERROR_OPEN;
+        p_limit->p_status_max[th] = eTH_ERROR_SHORT;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Handle status of all thermistors
+*
+* @note     Status is checked on filtered temperature. Loops are kept free 
+*           of branches, so that compiler can vectorize them. Thermistors 
+*           without new sample keep their status, as check depends only 
+*           on filtered temperature and previous status.
+*
+*           While out of range status is active, its limit is moved 
+*           inwards by hysteresis. Changed status is taken only after 
+*           the same status is seen on "debounce" consecutive new 
+*           samples, alternating candidates (e.g. open and short) are 
+*           never confirmed. Range check and debounce are separate 
+*           passes, as single loop over all arrays exceeds alias checks 
+*           compiler does for vectorization.
+*
+*           With TH_DIAG_EN held sensor diagnostics fault is candidate
+*           when temperature is in range and current status is not 
+*           range fault, so sensor returning from open or short goes 
+*           first to OK. Diagnostics fault is debounced the same way as 
+*           range status. With eTH_ERR_PERMANENT confirmed diagnostics 
+*           fault is kept by range check as any other error status, 
+*           fault not yet confirmed is not latched.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_status_hndl(th_ctx_t * const p_ctx)
+{
+    const th_temp_t * const     p_temp      = p_ctx->data.p_temp_filt;
+    th_status_t * const         p_status    = p_ctx->data.p_status;
+    const th_temp_t * const     p_min       = p_ctx->limit.p_range_min;
+    const th_temp_t * const     p_max       = p_ctx->limit.p_range_max;
+    const th_temp_t * const     p_clr_min   = p_ctx->limit.p_clear_min;
+    const th_temp_t * const     p_clr_max   = p_ctx->limit.p_clear_max;
+    const th_status_t * const   p_st_min    = p_ctx->limit.p_status_min;
+    const th_status_t * const   p_st_max    = p_ctx->limit.p_status_max;
+    const th_err_type_t * const p_err_type  = p_ctx->limit.p_err_type;
+    th_status_t * const         p_cand      = p_ctx->limit.p_status_cand;
+    const uint32_t * const      p_debounce  = p_ctx->limit.p_debounce;
+    th_status_t * const         p_deb_cand  = p_ctx->limit.p_deb_cand;
+    uint32_t * const            p_deb_cnt   = p_ctx->limit.p_deb_cnt;
+    uint32_t * const            p_is_new    = p_ctx->limit.p_is_new;
+    const uint32_t              num_of      = p_ctx->num_of;
+
+    #if ( 1 == TH_DIAG_EN )
+        const th_status_t * const p_diag    = p_ctx->limit.p_status_diag;
+        uint32_t * const          p_hold    = p_ctx->limit.p_diag_hold;
+    #endif
+
+    // Range check
+    for ( uint32_t th = 0; th < num_of; th++ )
+    {
+        const th_temp_t     temp    = p_temp[th];
+        const th_status_t   prev    = p_status[th];
+        const th_status_t   st_min  = p_st_min[th];
+        const th_status_t   st_max  = p_st_max[th];
+        const th_temp_t     rng_min = p_min[th];
+        const th_temp_t     rng_max = p_max[th];
+        const th_temp_t     clr_min = p_clr_min[th];
+        const th_temp_t     clr_max = p_clr_max[th];
+        th_status_t         status  = eTH_OK;
+
+        // Active limit is moved inwards by hysteresis
+        const th_temp_t     min     = ( st_min == prev ) ? clr_min : rng_min;
+        const th_temp_t     max     = ( st_max == prev ) ? clr_max : rng_max;
+
+        // Status of NORMAL, above MAX or bellow MIN range
+        status = ( temp < min ) ? st_min : status;
+        status = ( temp > max ) ? st_max : status;
+
+        // Permanent error type keeps error status
+        status = (( eTH_ERR_PERMANENT == p_err_type[th] ) && ( eTH_OK != prev )) ? prev : status;
+
+        p_cand[th] = status;
+    }
+
+    // Debounce
+    for ( uint32_t th = 0; th < num_of; th++ )
+    {
+        const th_status_t   prev    = p_status[th];
+        const uint32_t      is_new  = p_is_new[th];
+
+        // Range status takes precedence over diagnostics
+        #if ( 1 == TH_DIAG_EN )
+            const th_status_t   range   = p_cand[th];
+            const uint32_t      hold    = p_hold[th];
+            const bool          is_rng  = (( eTH_ERROR_OPEN == prev ) || ( eTH_ERROR_SHORT == prev ));
+            const th_status_t   diag    = (( hold > 0U ) && ( false == is_rng )) ? p_diag[th] : eTH_OK;
+            const th_status_t   cand    = ( eTH_OK == range ) ? diag : range;
+
+            // Held fault expires after debounce new samples
+            p_hold[th] = ( hold > 0U ) ? ( hold - is_new ) : 0U;
+        #else
+            const th_status_t   cand    = p_cand[th];
+        #endif
+
+        const uint32_t      deb     = p_debounce[th];
+        uint32_t            cnt     = p_deb_cnt[th];
+
+        // Count consecutive new samples with the same changed status, 
+        // change of candidate itself restarts counting
+        cnt = ( cand == p_deb_cand[th] ) ? ( cnt + is_new ) : is_new;
+        cnt = ( cand != prev ) ? cnt : 0U;
+
+        p_deb_cand[th] = cand;
+
+        // Take changed status only when confirmed
+        const bool is_confirmed = ( cnt >= deb );
+
+        p_status[th]    = is_confirmed ? cand : prev;
+        p_deb_cnt[th]   = is_confirmed ? 0U : cnt;
+    }
+
+    // New samples are consumed
+    memset( p_is_new, 0, ( num_of * sizeof( uint32_t )));
+}
+
+#if ( 1 == TH_ALARM_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init alarm limits of thermistor
+    *
+    * @note     Disabled alarm gets limit that can not be crossed.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_init_alarm(th_ctx_t * const p_ctx, const uint32_t th)
+    {
+        const th_cfg_t * const  p_cfg   = &p_ctx->p_cfg[th];
+        const th_limit_t * const p_limit = &p_ctx->limit;
+        const float32_t         hyst    = p_cfg->alarm.hyst;
+        const float32_t         lim[TH_ALARM_NUM_OF] =
+        {
+            p_cfg->alarm.warn_low,
+            p_cfg->alarm.warn_high,
+            p_cfg->alarm.crit_low,
+            p_cfg->alarm.crit_high,
+        };
+
+        for ( uint32_t lvl = 0; lvl < TH_ALARM_NUM_OF; lvl++ )
+        {
+            const uint32_t  idx     = (( lvl * p_ctx->num_of ) + th );
+            const bool      is_high = ( 0U != ( lvl & 1U ));
+
+            if ( 0U != ( p_cfg->alarm.en & ( 1U << lvl )))
+            {
+                p_limit->p_alarm_set[idx] = TH_DEGC_TO_TEMP( lim[lvl] );
+                p_limit->p_alarm_clr[idx] = TH_DEGC_TO_TEMP(( true == is_high ) ? ( lim[lvl] - hyst ) : ( lim[lvl] + hyst ));
+            }
+            else
+            {
+                p_limit->p_alarm_set[idx] = ( true == is_high ) ? TH_TEMP_MAX : TH_TEMP_MIN;
+                p_limit->p_alarm_clr[idx] = p_limit->p_alarm_set[idx];
+            }
+        }
+
+        p_ctx->data.p_alarm[th] = 0U;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Handle alarms of all thermistors
+    *
+    * @note     Alarms are checked on filtered temperature, one alarm 
+    *           level over all thermistors per loop, so that loop is free 
+    *           of branches and can be vectorized. While alarm is active,
+    *           its limit is moved inwards by hysteresis.
+    *
+    *           Faulty thermistor temperature is not valid, its alarms
+    *           are cleared and fault is reported by status only.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_alarm_hndl(th_ctx_t * const p_ctx)
+    {
+        const th_temp_t * const     p_temp      = p_ctx->data.p_temp_filt;
+        const th_status_t * const   p_status    = p_ctx->data.p_status;
+        uint32_t * const            p_alarm     = p_ctx->data.p_alarm;
+        const uint32_t              num_of      = p_ctx->num_of;
+
+        for ( uint32_t lvl = 0; lvl < TH_ALARM_NUM_OF; lvl++ )
+        {
+            const th_temp_t * const p_set   = &p_ctx->limit.p_alarm_set[ lvl * num_of ];
+            const th_temp_t * const p_clr   = &p_ctx->limit.p_alarm_clr[ lvl * num_of ];
+            const uint32_t          bit     = ( 1UL << lvl );
+            const bool              is_high = ( 0U != ( lvl & 1U ));
+
+            for ( uint32_t th = 0; th < num_of; th++ )
+            {
+                const th_temp_t     temp    = p_temp[th];
+                const uint32_t      alarm   = p_alarm[th];
+                const th_temp_t     set     = p_set[th];
+                const th_temp_t     clr     = p_clr[th];
+                const bool          is_ok   = ( eTH_OK == p_status[th] );
+
+                // Active limit is moved inwards by hysteresis
+                const th_temp_t     lim     = ( 0U != ( alarm & bit )) ? clr : set;
+                const bool          is_over = is_high ? ( temp > lim ) : ( temp < lim );
+
+                p_alarm[th] = ( is_ok && is_over ) ? ( alarm | bit ) : ( alarm & ~bit );
+            }
+        }
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check single thermistor configuration
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @return       valid   - True if configuration is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool th_check_cfg(const th_cfg_t * const p_cfg)
+{
+    /**
+     *  Check for correct configuration
+     *
+     *      1. LPF filter cutoff frequency shall be higher that 0 Hz
+     *      2. Valid HW configuration are:
+     *          - eTH_HW_LOW_SIDE  with eTH_HW_PULL_UP
+     *          - eTH_HW_HIGH_SIDE with eTH_HW_PULL_DOWN
+     *          - eTH_HW_LOW_SIDE  with eTH_HW_PULL_BOTH
+     *          - eTH_HW_HIGH_SIDE with eTH_HW_PULL_BOTH
+     *      3. Range: Max is larger than min value
+     *      4. NTC beta factor and nominal value shall be higher than 0
+     *      5. NTC Steinhart-Hart B coefficient shall be higher than 0
+     *      6. NTC R-T table shall be valid
+     *      7. Update period shall not be negative and LPF cutoff frequency 
+     *         shall be bellow half of update rate
+     *      8. Oversampling ratio shall be valid
+     *      9. Median pre-filter window shall be valid
+     *     10. Both pull resistors shall be higher than 0
+     *     11. Range hysteresis shall not be negative and shall be smaller 
+     *         than range
+     *     12. Event threshold hysteresis shall not be negative
+     *     13. Alarm hysteresis shall not be negative
+     *     14. Maximum rate of change shall not be negative
+     */
+    return  (   ( p_cfg->lpf_fc > 0.0f )                                                                            // 1.
+            &&  (   (( eTH_HW_LOW_SIDE == p_cfg->hw.conn )   && ( eTH_HW_PULL_UP == p_cfg->hw.pull_mode ))          // 2.
+                ||  (( eTH_HW_HIGH_SIDE == p_cfg->hw.conn )  && ( eTH_HW_PULL_DOWN == p_cfg->hw.pull_mode  ))
+                ||  (( eTH_HW_LOW_SIDE == p_cfg->hw.conn )   && ( eTH_HW_PULL_BOTH == p_cfg->hw.pull_mode  ))
+                ||  (( eTH_HW_HIGH_SIDE == p_cfg->hw.conn )  && ( eTH_HW_PULL_BOTH == p_cfg->hw.pull_mode  )))
+            &&  ( p_cfg->range.max > p_cfg->range.min )                                                             // 3.
+            &&  (   ( eTH_TYPE_NTC != p_cfg->type )                                                                 // 4.
+                ||  (( p_cfg->ntc.beta > 0.0f ) && ( p_cfg->ntc.nom_val > 0.0f )))
+            &&  (   ( eTH_TYPE_NTC_SH != p_cfg->type )                                                              // 5.
+                ||  ( p_cfg->ntc_sh.b > 0.0f ))
+            &&  (   ( eTH_TYPE_NTC_TAB != p_cfg->type )                                                             // 6.
+                ||  ( true == th_check_ntc_tab( p_cfg )))
+            &&  ( p_cfg->period >= 0.0f )                                                                           // 7.
+            &&  ( p_cfg->lpf_fc < ( 0.5f * TH_HNDL_FREQ_HZ / (float32_t) ( th_calc_div( p_cfg->period ) * th_calc_os_ratio( p_cfg ))))
+            &&  ( true == th_check_oversample( p_cfg ))                                                             // 8.
+            &&  ( true == th_check_median( p_cfg ))                                                                 // 9.
+            &&  (   ( eTH_HW_PULL_BOTH != p_cfg->hw.pull_mode )                                                     // 10.
+                ||  (( p_cfg->hw.pull_up > 0.0f ) && ( p_cfg->hw.pull_down > 0.0f )))
+            &&  ( p_cfg->range.hyst >= 0.0f )                                                                       // 11.
+            &&  ( p_cfg->range.hyst < ( p_cfg->range.max - p_cfg->range.min ))
+            &&  ( p_cfg->thr.hyst >= 0.0f )                                                                         // 12.
+            &&  ( p_cfg->alarm.hyst >= 0.0f )                                                                       // 13.
+            &&  ( p_cfg->diag.rate_max >= 0.0f ));                                                                  // 14.
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check NTC R-T table configuration
+*
+* @note     Table must have at least two points, with temperature strictly
+*           increasing and resistance strictly decreasing. 
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @return       valid   - True if R-T table is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool th_check_ntc_tab(const th_cfg_t * const p_cfg)
+{
+    bool valid = false;
+
+    #if ( 1 == TH_NTC_TAB_EN )
+
+        const th_ntc_point_t * const p_points = p_cfg->ntc_tab.p_points;
+
+        if  (   ( NULL != p_points )
+            &&  ( p_cfg->ntc_tab.size >= 2U )
+            &&  ( p_points[0].temp > -273.15f )
+            &&  ( p_points[0].res > 0.0f ))
+        {
+            valid = true;
+
+            for ( uint32_t i = 1; i < p_cfg->ntc_tab.size; i++ )
+            {
+                if  (   ( p_points[i].temp <= p_points[i-1].temp )
+                    ||  ( p_points[i].res >= p_points[i-1].res )
+                    ||  ( p_points[i].res <= 0.0f ))
+                {
+                    valid = false;
+                    break;
+                }
+            }
+        }
+
+    #else
+
+        // R-T table model not enabled
+        (void) p_cfg;
+
+    #endif
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check oversampling configuration
+*
+* @note     Ratio shall be power of 2 up to TH_OVERSAMPLE_MAX and 
+*           decimated ADC code shall fit into 16 bits. Without 
+*           TH_OVERSAMPLE_EN ratio shall not be set.
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @return       valid   - True if oversampling configuration is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool th_check_oversample(const th_cfg_t * const p_cfg)
+{
+    bool valid = ( p_cfg->oversample <= 1U );
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+
+        const uint32_t ratio = p_cfg->oversample;
+
+        if ( false == valid )
+        {
+            valid = (   ( ratio <= TH_OVERSAMPLE_MAX )
+                    &&  ( 0U == ( ratio & ( ratio - 1U )))
+                    &&  (((( uint32_t) adc_get_raw_max() + 1UL ) << ( th_calc_log2( ratio ) / 2U )) <= ( UINT16_MAX + 1UL )));
+        }
+
+    #endif
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check median pre-filter configuration
+*
+* @note     Without TH_MEDIAN_EN window shall not be set.
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @return       valid   - True if median pre-filter configuration is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool th_check_median(const th_cfg_t * const p_cfg)
+{
+    bool valid = ( p_cfg->median <= 1U );
+
+    #if ( 1 == TH_MEDIAN_EN )
+        valid = (   ( true == valid )
+                ||  ( 3U == p_cfg->median )
+                ||  ( 5U == p_cfg->median )
+                ||  ( 7U == p_cfg->median ));
+    #endif
+
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check configuration table
+*
+* @param[in]    p_cfg   - Configuration table
+* @param[in]    num_of  - Number of entries in configuration table
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_status_t th_check_cfg_table(const th_cfg_t * const p_cfg, const uint32_t num_of)
+{
+    th_status_t status = eTH_OK;
+
+    if ( NULL != p_cfg )
+    {
+        // Check all entries
+        for ( uint32_t th = 0; th < num_of; th++ )
+        {
+            if ( false == th_check_cfg( &p_cfg[th] ))
+            {
+                status = eTH_ERROR;
+                TH_DBG_PRINT( "ERROR: Invalid thermistor configuration at %d entry!", th );
+                break;
+            }
+        }
+    }
+    else
+    {
+        status = eTH_ERROR;
+        TH_DBG_PRINT( "ERROR: Missing thermistor config table!" );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Take section from context storage
+*
+* @param[in]    p_mem   - Context storage, NULL for size calculation only
+* @param[in,out]p_size  - Used size of context storage in bytes
+* @param[in]    size    - Size of section in bytes
+* @return       p_sec   - Pointer to section, NULL for size calculation only
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * th_ctx_take(uint8_t * const p_mem, uint32_t * const p_size, const uint32_t size)
+{
+    void * p_sec = NULL;
+
+    if ( NULL != p_mem )
+    {
+        p_sec = &p_mem[*p_size];
+    }
+
+    *p_size += TH_CTX_ALIGN_UP( size );
+
+    return p_sec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Layout context storage
+*
+* @note     Storage starts with context itself, followed by arrays of 
+*           thermistor values and optional sections, each aligned to 
+*           TH_CTX_ALIGN bytes.
+*
+* @param[in]    p_cfg   - Configuration table
+* @param[in]    num_of  - Number of entries in configuration table
+* @param[out]   p_ctx   - Thermistor context, NULL for size calculation only
+* @return       size    - Size of context storage in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t th_ctx_layout(const th_cfg_t * const p_cfg, const uint32_t num_of, th_ctx_t * const p_ctx)
+{
+    th_ctx_t        ctx     = {0};
+    th_ctx_t * const p      = ( NULL != p_ctx ) ? p_ctx : &ctx;
+    uint8_t * const p_mem   = (uint8_t*) p_ctx;
+    uint32_t        size    = TH_CTX_ALIGN_UP( sizeof( th_ctx_t ));
+
+    p->data.p_raw           = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint16_t )));
+    p->data.p_res           = th_ctx_take( p_mem, &size, ( num_of * sizeof( float32_t )));
+    p->data.p_temp          = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->data.p_temp_filt     = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->data.p_status        = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+
+    #if ( 1 == TH_ALARM_EN )
+        p->data.p_alarm     = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    #endif
+
+    p->limit.p_range_min    = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->limit.p_range_max    = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->limit.p_clear_min    = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->limit.p_clear_max    = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+    p->limit.p_status_min   = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+    p->limit.p_status_max   = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+    p->limit.p_status_cand  = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+    p->limit.p_err_type     = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_err_type_t )));
+    p->limit.p_debounce     = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    p->limit.p_deb_cand     = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+    p->limit.p_deb_cnt      = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    p->limit.p_is_new       = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+
+    #if ( 1 == TH_ALARM_EN )
+        p->limit.p_alarm_set    = th_ctx_take( p_mem, &size, ( num_of * TH_ALARM_NUM_OF * sizeof( th_temp_t )));
+        p->limit.p_alarm_clr    = th_ctx_take( p_mem, &size, ( num_of * TH_ALARM_NUM_OF * sizeof( th_temp_t )));
+    #endif
+
+    #if ( 1 == TH_DIAG_EN )
+        p->limit.p_rate_max     = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+        p->limit.p_stuck_max    = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->limit.p_stuck_cnt    = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->limit.p_status_diag  = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+        p->limit.p_diag_hold    = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    #endif
+
+    p->p_coef               = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_coef_t )));
+    p->p_adc_ch             = th_ctx_take( p_mem, &size, ( num_of * sizeof( adc_ch_t )));
+    p->p_div                = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    p->p_cnt                = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+
+    #if ( 1 == TH_FILTER_EN )
+        p->lpf.p_fc         = th_ctx_take( p_mem, &size, ( num_of * sizeof( float32_t )));
+        p->lpf.p_k          = th_ctx_take( p_mem, &size, ( num_of * sizeof( *p->lpf.p_k )));
+
+        #if ( 1 == TH_FIXED_POINT_EN )
+            p->lpf.p_y      = th_ctx_take( p_mem, &size, ( num_of * sizeof( int32_t )));
+        #endif
+    #endif
+
+    #if ( 1 == TH_OVERSAMPLE_EN )
+        p->os.p_acc         = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->os.p_cnt         = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->os.p_ratio       = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->os.p_shift       = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    #endif
+
+    #if ( 1 == TH_MEDIAN_EN )
+        p->med.p_hist       = th_ctx_take( p_mem, &size, ( num_of * TH_MEDIAN_HIST_SIZE * sizeof( uint16_t )));
+        p->med.p_idx        = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        p->med.p_win        = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    #endif
+
+    #if ( 1 == TH_LUT_EN )
+        p->pp_lut           = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_lut_t* )));
+        p->p_lut_mem        = th_ctx_take( p_mem, &size, ( num_of * TH_LUT_SIZE * sizeof( th_lut_t )));
+    #endif
+
+    #if ( 1 == TH_NTC_TAB_EN )
+
+        // Pool fits R-T tables of all thermistors
+        p->ntc_seg_size = 0U;
+
+        for ( uint32_t th = 0; th < num_of; th++ )
+        {
+            if ( eTH_TYPE_NTC_TAB == p_cfg[th].type )
+            {
+                p->ntc_seg_size += p_cfg[th].ntc_tab.size;
+            }
+        }
+
+        p->p_ntc_seg = th_ctx_take( p_mem, &size, ( p->ntc_seg_size * sizeof( th_ntc_seg_t )));
+
+    #else
+        (void) p_cfg;
+    #endif
+
+    #if ( 1 == TH_EVENT_EN )
+        p->evt.p_status     = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+
+        #if ( 1 == TH_ALARM_EN )
+            p->evt.p_alarm  = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+        #endif
+
+        p->evt.p_thr        = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+        p->evt.p_thr_clr    = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+        p->evt.p_above      = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+    #endif
+
+    #if ( 1 == TH_SNAPSHOT_EN )
+
+        for ( uint32_t i = 0; i < 2U; i++ )
+        {
+            p->pub[i].p_raw         = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint16_t )));
+            p->pub[i].p_res         = th_ctx_take( p_mem, &size, ( num_of * sizeof( float32_t )));
+            p->pub[i].p_temp        = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+            p->pub[i].p_temp_filt   = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_temp_t )));
+            p->pub[i].p_status      = th_ctx_take( p_mem, &size, ( num_of * sizeof( th_status_t )));
+
+            #if ( 1 == TH_ALARM_EN )
+                p->pub[i].p_alarm   = th_ctx_take( p_mem, &size, ( num_of * sizeof( uint32_t )));
+            #endif
+        }
+
+    #endif
+
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Start thermistor context
+*
+* @note     Context storage and configuration table must be assigned 
+*           before!
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_status_t th_ctx_start(th_ctx_t * const p_ctx)
+{
+    th_status_t status = eTH_OK;
+
+    // Check configuration table
+    status = th_check_cfg_table( p_ctx->p_cfg, p_ctx->num_of );
+
+    // Pre-calculate coefficients and limits
+    if ( eTH_OK == status )
+    {
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            th_init_coef( &p_ctx->p_cfg[th], &p_ctx->p_coef[th] );
+            th_init_limit( p_ctx, th );
+
+            #if ( 1 == TH_ALARM_EN )
+                th_init_alarm( p_ctx, th );
+            #endif
+
+            #if ( 1 == TH_OVERSAMPLE_EN )
+                th_os_init( p_ctx, th );
+            #endif
+        }
+    }
+
+    // Spread channel updates
+    if ( eTH_OK == status )
+    {
+        th_sched_init( p_ctx );
+    }
+
+    // Pre-calculate NTC R-T tables
+    #if ( 1 == TH_NTC_TAB_EN )
+        if ( eTH_OK == status )
+        {
+            status = th_ntc_tab_init( p_ctx );
+        }
+    #endif
+
+    // Build look-up tables
+    #if ( 1 == TH_LUT_EN )
+        if ( eTH_OK == status )
+        {
+            status = th_lut_init( p_ctx );
+        }
+    #endif
+
+    if ( eTH_OK == status )
+    {
+        // Init all thermistors
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            const th_data_t * const p_data = &p_ctx->data;
+
+            // Get current temperature
+            adc_get_raw( p_ctx->p_adc_ch[th], &p_data->p_raw[th] );
+
+            #if ( 1 == TH_MEDIAN_EN )
+                th_med_init( p_ctx, th, p_data->p_raw[th] );
+            #endif
+
+            #if ( 1 == TH_OVERSAMPLE_EN )
+                p_data->p_raw[th]   = (uint16_t) ( p_data->p_raw[th] << p_ctx->p_coef[th].os_bits );
+            #endif
+
+            p_data->p_temp[th]      = th_conv_raw_to_temperature( p_ctx, th, p_data->p_raw[th] );
+            p_data->p_temp_filt[th] = p_data->p_temp[th];
+
+            // Init filter
+            #if ( 1 == TH_FILTER_EN )
+                th_lpf_init( p_ctx, th, p_data->p_temp[th] );
+            #endif
+        }
+    }
+
+    // Init success
+    if ( eTH_OK == status )
+    {
+        // Alarms of initial temperature
+        #if ( 1 == TH_ALARM_EN )
+            th_alarm_hndl( p_ctx );
+        #endif
+
+        th_pub_write( p_ctx );
+
+        // Take current state as reported
+        #if ( 1 == TH_EVENT_EN )
+            th_evt_init( p_ctx );
+        #endif
+
+        // Conversions at init are not part of statistics
+        #if ( 1 == TH_PERF_EN )
+            th_perf_reset( p_ctx );
+        #endif
+
+        p_ctx->is_init = true;
+    }
+
+    return status;
+}
+
+#if ( 1 == TH_LUT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init look-up tables
+    *
+    * @note     Table point "i" holds temperature at ADC code "i << shift", 
+    *           where shift is difference between ADC and table resolution.
+    *
+    *           Tables are build in context storage. Only default context
+    *           with TH_LUT_IN_FLASH takes constant tables from configuration.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_status_t th_lut_init(th_ctx_t * const p_ctx)
+    {
+        th_status_t     status  = eTH_OK;
+        const uint16_t  raw_max = adc_get_raw_max();
+        uint32_t        adc_res = 0U;
+
+        // Get ADC resolution in bits
+        while (( 1UL << adc_res ) <= raw_max )
+        {
+            adc_res++;
+        }
+
+        // Table resolution cannot be higher than ADC resolution
+        if ( TH_LUT_RES_BITS <= adc_res )
+        {
+            p_ctx->lut_shift    = ( adc_res - TH_LUT_RES_BITS );
+            p_ctx->lut_k        = ( 1.0f / (float32_t) ( 1UL << p_ctx->lut_shift ));
+
+            // Interpolation also over additional bits of decimated ADC code
+            #if ( 1 == TH_OVERSAMPLE_EN )
+                for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+                {
+                    p_ctx->p_coef[th].lut_k = ( 1.0f / (float32_t) ( 1UL << ( p_ctx->lut_shift + p_ctx->p_coef[th].os_bits )));
+                }
+            #endif
+
+            // Build tables for all thermistors
+            if ( NULL != p_ctx->p_lut_mem )
+            {
+                for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+                {
+                    th_lut_t * const        p_lut   = &p_ctx->p_lut_mem[ th * TH_LUT_SIZE ];
+                    const th_coef_t * const p_coef  = &p_ctx->p_coef[th];
+
+                    for ( uint32_t i = 0; i < TH_LUT_SIZE; i++ )
+                    {
+                        uint32_t raw = ( i << p_ctx->lut_shift );
+
+                        // Last point is above ADC range
+                        if ( raw > raw_max )
+                        {
+                            raw = raw_max;
+                        }
+
+                        #if ( 1 == TH_OVERSAMPLE_EN )
+                            raw <<= p_coef->os_bits;
+                        #endif
+
+                        p_lut[i] = TH_DEGC_TO_TEMP( th_calc_temperature( p_coef, th_calc_resistance( p_coef, (uint16_t) raw )));
+                    }
+
+                    p_ctx->pp_lut[th] = p_lut;
+                }
+            }
+
+            #if ( 1 == TH_LUT_IN_FLASH )
+
+                // Get constant tables
+                else
+                {
+                    const th_lut_t * const * pp_lut = th_cfg_get_lut_table();
+
+                    for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+                    {
+                        if ( NULL != pp_lut[th] )
+                        {
+                            // Check middle table point against calculation to catch table
+                            // generated for different HW or sensor configuration
+                            const th_coef_t * const p_coef  = &p_ctx->p_coef[th];
+                            const uint32_t          mid     = ( TH_LUT_SIZE / 2UL );
+                            uint32_t                raw     = ( mid << p_ctx->lut_shift );
+
+                            #if ( 1 == TH_OVERSAMPLE_EN )
+                                raw <<= p_coef->os_bits;
+                            #endif
+
+                            const float32_t         temp    = th_calc_temperature( p_coef, th_calc_resistance( p_coef, (uint16_t) raw ));
+
+                            if ( fabsf( TH_TEMP_TO_DEGC( pp_lut[th][mid] ) - temp ) < TH_LUT_CHECK_TOL )
+                            {
+                                p_ctx->pp_lut[th] = pp_lut[th];
+                            }
+                            else
+                            {
+                                status = eTH_ERROR;
+                                TH_DBG_PRINT( "ERROR: Thermistor LUT mismatch with configuration at %d entry!", th );
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            status = eTH_ERROR;
+                            TH_DBG_PRINT( "ERROR: Missing thermistor LUT at %d entry!", th );
+                            break;
+                        }
+                    }
+                }
+
+            #endif
+        }
+        else
+        {
+            status = eTH_ERROR;
+            TH_DBG_PRINT( "ERROR: Thermistor LUT resolution higher than ADC resolution!" );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get temperature from look-up table
+    *
+    * @note     With TH_FIXED_POINT_EN interpolation is done in integer
+    *           arithmetics only.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index
+    * @param[in]    raw     - RAW ADC code
+    * @return       temp    - Interpolated temperature in internal units
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_temp_t th_lut_get_temperature(const th_ctx_t * const p_ctx, const uint32_t th, const uint16_t raw)
+    {
+        #if ( 1 == TH_OVERSAMPLE_EN )
+            const uint32_t      shift   = ( p_ctx->lut_shift + p_ctx->p_coef[th].os_bits );
+            const float32_t     lut_k   = p_ctx->p_coef[th].lut_k;
+        #else
+            const uint32_t      shift   = p_ctx->lut_shift;
+            const float32_t     lut_k   = p_ctx->lut_k;
+        #endif
+
+        const uint32_t          idx     = ((uint32_t) raw >> shift );
+        const uint32_t          frac    = ((uint32_t) raw - ( idx << shift ));
+        const th_lut_t * const  p_lut   = &p_ctx->pp_lut[th][idx];
+
+        // Linear interpolation between two table points
+        #if ( 1 == TH_FIXED_POINT_EN )
+            (void) lut_k;
+            return (th_temp_t) ( p_lut[0] + (int32_t) ((( (int64_t) p_lut[1] - p_lut[0] ) * (int64_t) frac ) >> shift ));
+        #else
+            return (th_temp_t) ( p_lut[0] + (( p_lut[1] - p_lut[0] ) * (float32_t) frac * lut_k ));
+        #endif
+    }
+
+#endif
+
+#if ( 1 == TH_NTC_TAB_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Init NTC R-T table pre-calculated points
+    *
+    * @note     Points of all thermistors with R-T table model are placed 
+    *           one after another into common pool of context.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_status_t th_ntc_tab_init(th_ctx_t * const p_ctx)
+    {
+        th_status_t status  = eTH_OK;
+        uint32_t    used    = 0U;
+
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            if ( eTH_TYPE_NTC_TAB == p_ctx->p_cfg[th].type )
+            {
+                const th_ntc_point_t * const    p_points    = p_ctx->p_cfg[th].ntc_tab.p_points;
+                const uint32_t                  size        = p_ctx->p_cfg[th].ntc_tab.size;
+                th_ntc_seg_t * const            p_seg       = &p_ctx->p_ntc_seg[used];
+
+                // Check pool space
+                if (( used + size ) > p_ctx->ntc_seg_size )
+                {
+                    status = eTH_ERROR;
+                    TH_DBG_PRINT( "ERROR: Thermistor R-T table pool too small at %d entry!", th );
+                    break;
+                }
+
+                // Logarithm of resistance and inverse of temperature
+                for ( uint32_t i = 0; i < size; i++ )
+                {
+                    p_seg[i].ln_res     = logf( p_points[i].res );
+                    p_seg[i].inv_temp   = ( 1.0f / ( p_points[i].temp + 273.15f ));
+                }
 
-    #if ( 1 == TH_FILTER_EN )
-        p_filter_rc_t lpf;   /**<Low pass filter */
-    #endif
+                // Slopes, last point continues slope of last segment
+                for ( uint32_t i = 0; i < ( size - 1U ); i++ )
+                {
+                    p_seg[i].k = (( p_seg[i+1].inv_temp - p_seg[i].inv_temp ) / ( p_seg[i+1].ln_res - p_seg[i].ln_res ));
+                }
+                p_seg[size-1U].k = p_seg[size-2U].k;
 
-    th_status_t status;    /**<Thermistor status */
-} th_data_t;
+                p_ctx->p_coef[th].p_ntc_seg     = p_seg;
+                p_ctx->p_coef[th].ntc_seg_num   = size;
 
-////////////////////////////////////////////////////////////////////////////////
-// Variables
-////////////////////////////////////////////////////////////////////////////////
+                used += size;
+            }
+        }
 
-/**
- * Initialization guards
- */
-static bool gb_is_init = false;
+        return status;
+    }
 
-/**
- *     Pointer to configuration table
- */
-static const th_cfg_t * gp_cfg_table = NULL;
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Convert NTC resistance to degree C with R-T table model
+    *
+    * @note     Segment is found by binary search over logarithm of point
+    *           resistance, outside of table first/last segment is 
+    *           extrapolated.
+    *
+    * @param[in]    p_coef  - Thermistor coefficients
+    * @param[in]    rth     - Resistance of NTC thermistor
+    * @return       temp    - Calculated temperature
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static float32_t th_calc_ntc_tab_temperature(const th_coef_t * const p_coef, const float32_t rth)
+    {
+        const th_ntc_seg_t * const  p_seg   = p_coef->p_ntc_seg;
+        const float32_t             ln_rth  = logf( rth );
+        uint32_t                    lo      = 0U;
+        uint32_t                    hi      = ( p_coef->ntc_seg_num - 1U );
 
-/**
- *  Thermistor data
- */
-static th_data_t g_th_data[eTH_NUM_OF] = {0};
+        // Find segment, resistance is decreasing with index
+        while (( hi - lo ) > 1U )
+        {
+            const uint32_t mid = (( lo + hi ) >> 1U );
 
-////////////////////////////////////////////////////////////////////////////////
-// Function Prototypes
-////////////////////////////////////////////////////////////////////////////////
-static float32_t    th_calc_res_single_pull     (const th_ch_t th);
-static float32_t    th_calc_res_both_pull       (const th_ch_t th);
-static float32_t    th_calc_resistance          (const th_ch_t th);
-static float32_t    th_calc_ntc_temperature     (const float32_t rth, const float32_t beta, const float32_t rth_nom);
-static float32_t    th_calc_pt100_temperature   (const float32_t rth);
-static float32_t    th_calc_pt500_temperature   (const float32_t rth);
-static float32_t    th_calc_pt1000_temperature  (const float32_t rth);
-static th_status_t  th_init_filter              (const th_ch_t th);
-static th_status_t  th_status_hndl              (const th_ch_t th, const float32_t temp);
-static th_status_t  th_check_cfg_table          (const th_cfg_t * const p_cfg);
+            if ( ln_rth < p_seg[mid].ln_res )
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
 
-static inline float32_t th_limit_f32            (const float32_t in, const float32_t min, const float32_t max);
+        return (float32_t) (( 1.0f / ( p_seg[lo].inv_temp + ( p_seg[lo].k * ( ln_rth - p_seg[lo].ln_res )))) - 273.15f );
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-// Functions
-////////////////////////////////////////////////////////////////////////////////
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Calculate resistance of thermistor with single pull resistor
+* @brief        Calculate resistance of buffer of RAW ADC codes
 *
-* @param[in]    th  - Thermistor option
-* @return       res - Resistance of thermistor
+* @note     Loops are kept free of function calls and branches, so that
+*           compiler can auto-vectorize them.
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in]    p_raw   - Buffer of RAW ADC codes
+* @param[out]   p_res   - Buffer of limited thermistor resistances
+* @param[in]    size    - Number of samples
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_res_single_pull(const th_ch_t th)
+static void th_batch_calc_res(const th_cfg_t * const p_cfg, const th_coef_t * const p_coef, const uint16_t * const p_raw, float32_t * const p_res, const uint32_t size)
 {
-    float32_t   th_res  = 0.0f;
-    uint16_t    adc_raw = 0U;
+    const float32_t raw_max = p_coef->raw_max;
+    const float32_t pull    = p_coef->pull;
+    const float32_t res_min = p_coef->res_min;
+    const float32_t res_max = p_coef->res_max;
+
+    // Both pull resistors
+    if ( eTH_HW_PULL_BOTH == p_cfg->hw.pull_mode )
+    {
+        const float32_t n0 = p_coef->both_n0;
+        const float32_t n1 = p_coef->both_n1;
+        const float32_t d0 = p_coef->both_d0;
+        const float32_t d1 = p_coef->both_d1;
 
-    // Get raw adc value
-    adc_get_raw( gp_cfg_table[th].adc_ch, &adc_raw );
+        for ( uint32_t i = 0; i < size; i++ )
+        {
+            const float32_t adc = ((float32_t) p_raw[i] + 1.0f );
+            const float32_t den = ( d0 + ( d1 * adc ));
+            const float32_t res = ( den > 0.0f ) ? (( n0 + ( n1 * adc )) / den ) : 1e6f;
 
-    // Calculate ADC ratio
-    const float32_t adc_ratio = ((float32_t)((float32_t) adc_get_raw_max() / (float32_t) ( adc_raw + 1U ))); // +1 to prevent dividing by zero!
+            p_res[i] = th_limit_f32( res, res_min, res_max );
+        }
+    }
 
     // Thermistor on low side
-    if ( eTH_HW_LOW_SIDE == gp_cfg_table[th].hw.conn )
+    else if ( eTH_HW_LOW_SIDE == p_cfg->hw.conn )
     {
-        if ( adc_ratio < 1.0f )
-        {
-            th_res = (float32_t) ( gp_cfg_table[th].hw.pull_up / ( adc_ratio - 1.0f ));
-        }
-        else
+        for ( uint32_t i = 0; i < size; i++ )
         {
-            th_res = 1e6f;  // ADC ration is above 1 means Rth is very high!
+            const float32_t adc = ((float32_t) p_raw[i] + 1.0f );
+            const float32_t res = ( adc < raw_max ) ? (( pull * adc ) / ( raw_max - adc )) : 1e6f;
+
+            p_res[i] = th_limit_f32( res, res_min, res_max );
         }
     }
 
     // Thermistor on high side
     else
     {
-        if ( adc_ratio < 1.0f )
-        {
-            th_res = (float32_t) ( gp_cfg_table[th].hw.pull_down * ( adc_ratio - 1.0f ));
-        }
-        else
+        for ( uint32_t i = 0; i < size; i++ )
         {
-            th_res = 0.0f;  // ADC ration is above 1 means Rth is 0 ohm!
+            const float32_t adc = ((float32_t) p_raw[i] + 1.0f );
+            const float32_t res = ( adc < raw_max ) ? (( pull * ( raw_max - adc )) / adc ) : 0.0f;
+
+            p_res[i] = th_limit_f32( res, res_min, res_max );
         }
-    } 
-    
-    return th_res;     
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Calculate resistance of thermistor with both pull resistors
+* @brief        Calculate temperature of buffer of thermistor resistances
+*
+* @note     NTC calculation uses polynomial approximation of logarithm
+*           as standard library logf() prevents auto-vectorization.
 *
-* @param[in]    th  - Thermistor option
-* @return       res - Resistance of thermistor
+* @param[in]    p_cfg   - Thermistor configuration
+* @param[in]    p_coef  - Thermistor coefficients
+* @param[in,out]p_temp  - Buffer of resistances, overwritten with temperatures
+* @param[in]    size    - Number of samples
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_res_both_pull(const th_ch_t th)
+static void th_batch_calc_temp(const th_cfg_t * const p_cfg, const th_coef_t * const p_coef, float32_t * const p_temp, const uint32_t size)
 {
-    float32_t th_res    = 0.0f;
+    switch( p_cfg->type )
+    {
+        case eTH_TYPE_NTC:
+        {
+            const float32_t ntc_k           = p_coef->ntc_k;
+            const float32_t ntc_inv_beta    = p_coef->ntc_inv_beta;
 
-    // TODO: Implementation needed!
-    (void) th;
-    
-    return th_res;     
+            for ( uint32_t i = 0; i < size; i++ )
+            {
+                p_temp[i] = (float32_t) (( 1.0f / ( ntc_k + ( ntc_inv_beta * th_fast_logf( p_temp[i] )))) - 273.15f );
+            }
+            break;
+        }
+
+        case eTH_TYPE_NTC_SH:
+        {
+            const float32_t a = p_coef->ntc_k;
+            const float32_t b = p_coef->ntc_inv_beta;
+            const float32_t c = p_coef->ntc_c;
+
+            for ( uint32_t i = 0; i < size; i++ )
+            {
+                const float32_t ln_rth = th_fast_logf( p_temp[i] );
+
+                p_temp[i] = (float32_t) (( 1.0f / ( a + ( ln_rth * ( b + ( c * ln_rth * ln_rth ))))) - 273.15f );
+            }
+            break;
+        }
+
+        case eTH_TYPE_PT100:
+        case eTH_TYPE_PT500:
+        case eTH_TYPE_PT1000:
+            for ( uint32_t i = 0; i < size; i++ )
+            {
+                p_temp[i] = th_calc_pt_temperature( p_coef, p_temp[i] );
+            }
+            break;
+
+        default:
+            TH_ASSERT( 0 );
+            break;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Calculate resistance of thermistor
-*
-* @note     In case of unplasible voltage -1 is returned!
+* @brief        Limit floating point value
 *
-* @param[in]    th  - Thermistor option
-* @return       res - Resistance of thermistor
+* @param[in]    in    - Input value to limit
+* @param[in]    min    - Minimum value limit
+* @param[in]    max    - Maximum value
+* @return       out    - Limited output value
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_resistance(const th_ch_t th)
+static inline float32_t th_limit_f32(const float32_t in, const float32_t min, const float32_t max)
 {
-    float32_t th_res        = 0.0f;
-    float32_t th_res_lim    = 0.0f;
+    float32_t out = in;
 
-    // Single pull resistor
-    if  (   ( eTH_HW_PULL_UP    == gp_cfg_table[th].hw.pull_mode )
-        ||  ( eTH_HW_PULL_DOWN  == gp_cfg_table[th].hw.pull_mode ))
+    if ( in > max )
+    {
+        out = max;
+    }
+    else if ( in < min )
     {
-        th_res = th_calc_res_single_pull( th );
+        out = min;
     }
-
-    // Both pull resistors
     else
     {
-        th_res = th_calc_res_both_pull( th );
+        out = in;
     }
 
-    // Limit thermistor resistance
-    switch( gp_cfg_table[th].type )
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Fast natural logarithm approximation
+*
+* @note     Input is split into exponent and mantissa in range [2/3, 4/3),
+*           then log1p(m - 1) is approximated with polynomial. Maximum 
+*           absolute error is 1.6e-5 for positive normal inputs, which
+*           gives NTC temperature error bellow 0.002 degC.
+*
+*           Only integer and multiply-add operations are used, therefore 
+*           it can be vectorized by compiler.
+*
+* @param[in]    x   - Input value, must be positive
+* @return       y   - Natural logarithm of input
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t th_fast_logf(const float32_t x)
+{
+    union
     {
-        case eTH_TYPE_NTC:
-            th_res_lim = th_limit_f32( th_res, 1.0f, 10e6f );
-            break;
+        float32_t   f;
+        uint32_t    u;
+    } m = { .f = x };
 
-        case eTH_TYPE_PT100:
-            th_res_lim = th_limit_f32( th_res, TH_PT100_MIN_OHM, TH_PT100_MAX_OHM );
-            break;
+    // Exponent relative to 2/3
+    const int32_t   e = (int32_t) (( m.u - 0x3F2AAAABUL ) & 0xFF800000UL );
+    m.u -= (uint32_t) e;
 
-        case eTH_TYPE_PT500:
-            th_res_lim = th_limit_f32( th_res, TH_PT500_MIN_OHM, TH_PT500_MAX_OHM );
-            break;
+    // log1p(f) for f in [-1/3, 1/3)
+    const float32_t f = ( m.f - 1.0f );
+    const float32_t s = ( f * f );
+    float32_t       r = (( 0.230836749f * f ) - 0.279208571f );
+    const float32_t t = (( 0.331826031f * f ) - 0.498910338f );
 
-        case eTH_TYPE_PT1000:
-            th_res_lim = th_limit_f32( th_res, TH_PT1000_MIN_OHM, TH_PT1000_MAX_OHM );
-            break;
+    r = (( r * s ) + t );
+    r = (( r * s ) + f );
 
-        default:
-            TH_ASSERT( 0 );
-            break;
+    // Add exponent part: e * 2^-23 * ln(2)
+    return (float32_t) ((((float32_t) e * 1.19209290e-7f ) * 0.693147182f ) + r );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup THERMISTOR_API
+* @{ <!-- BEGIN GROUP -->
+*
+*     Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Init thermistors
+*
+* @note     Inits default context with configuration table from 
+*           "thermistor_cfg.c".
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+th_status_t th_init(void)
+{
+    th_status_t status = eTH_OK;
+
+    if ( false == g_th_ctx.is_init )
+    {
+        // Get configuration table
+        g_th_ctx.p_cfg = th_cfg_get_table();
+
+        // Init default context
+        status = th_ctx_start( &g_th_ctx );
     }
 
-    return th_res_lim;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Convert NTC resistance to degree C
+* @brief        De-init thermistors
 *
-* @param[in]    rth     - Resistance of NTC thermistor
-* @param[in]    beta    - Beta factor of NTC
-* @param[in]    rth_nom - Nominal value of NTC @25 degC
-* @return       temp    - Calculated temperature
+* @return       status - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_ntc_temperature(const float32_t rth, const float32_t beta, const float32_t rth_nom)
+th_status_t th_deinit(void)
 {
-    float32_t temp = 0.0f;
+    th_status_t status = eTH_OK;
 
-    // Calculate temperature
-    temp = (float32_t) (( 1.0f / ( TH_NTC_25DEG_FACTOR + (( 1.0f / beta ) * log( rth / rth_nom )))) - 273.15f );
+    if ( true == g_th_ctx.is_init )
+    {
+        status = th_ctx_deinit( &g_th_ctx );
+    }
 
-    return temp;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Convert PT100 resistance to degree C
+* @brief        Get initialization flag
 *
-* @note     Calculation of PT500 according to DIN EN60751 standard.
-*           For futher details look at table: doc/pt1000_pt100_pt500_tables.xlsx 
+* @param[out]   p_is_init   - Initialization flag
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+th_status_t th_is_init(bool * const p_is_init)
+{
+    th_status_t status = eTH_OK;
+
+    if ( NULL != p_is_init )
+    {
+        *p_is_init = g_th_ctx.is_init;
+    }
+    else
+    {
+        status = eTH_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Thermistor main handler
 *
-* @param[in]    rth     - Resistance of PT100 thermistor
-* @return       temp    - Calculated temperature
+* @return       status - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_pt100_temperature(const float32_t rth)
+th_status_t th_hndl(void)
 {
-    float32_t temp  = 0.0f;
+    return th_ctx_hndl( &g_th_ctx );
+}
 
-    // Calculate temperature
-    temp = (float32_t) (( -TH_PT_DIN_EN60751_A + sqrtf( TH_PT_DIN_EN60751_AA - TH_PT_DIN_EN60751_4B * ( 1 - rth / 100.0f ))) / TH_PT_DIN_EN60751_2B );
-    
-    return temp;
+#if ( 1 == TH_HNDL_BUDGET_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Time-sliced thermistor handler
+    *
+    * @note     Replacement of th_hndl() with bounded execution time, see
+    *           th_ctx_hndl_budget() for details.
+    *
+    * @param[in]    budget  - Time budget in TH_GET_TIMESTAMP() units
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_hndl_budget(const uint32_t budget)
+    {
+        return th_ctx_hndl_budget( &g_th_ctx, budget );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get time-sliced handler lag
+    *
+    * @param[out]   p_lag   - Number of pending handler periods
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_hndl_lag(uint32_t * const p_lag)
+    {
+        return th_ctx_get_hndl_lag( &g_th_ctx, p_lag );
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Thermistor handler of fresh RAW ADC samples
+*
+* @note     Event driven alternative to th_hndl(), intended to be called
+*           from ADC scan complete or DMA half/full transfer interrupt.
+*           Buffer holds samples of consecutive ADC channels, starting
+*           with "ch_first". Only thermistors measured on those channels
+*           are processed, others are left untouched.
+*
+*           Sample rate of each thermistor shall be equal to handler
+*           period (TH_HNDL_PERIOD_S), thermistor update period is then
+*           applied the same way as in th_hndl().
+*
+* @param[in]    ch_first    - ADC channel of first sample in buffer
+* @param[in]    p_raw       - Buffer of RAW ADC codes
+* @param[in]    size        - Number of samples in buffer
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+th_status_t th_hndl_raw(const adc_ch_t ch_first, const uint16_t * const p_raw, const uint32_t size)
+{
+    return th_ctx_hndl_raw( &g_th_ctx, ch_first, p_raw, size );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Convert PT500 resistance to degree C
+* @brief        Get RAW temperature in ADC codes
 *
-* @note     Calculation of PT500 according to DIN EN60751 standard.
-*           For futher details look at table: doc/pt1000_pt100_pt500_tables.xlsx 
+* @note     Returns last processed sample, so that it matches temperature.
 *
-* @param[in]    rth     - Resistance of PT500 thermistor
-* @return       temp    - Calculated temperature
+*           With TH_OVERSAMPLE_EN and "oversample" ratio N configured 
+*           it is decimated ADC code with log2(N)/2 additional bits, 
+*           i.e. scaled by 2^(log2(N)/2). Its full scale is then 
+*           adc_get_raw_max() shifted left by the same bits, so it can
+*           exceed adc_get_raw_max().
+*
+* @param[in]    th      - Thermistor option
+* @param[out]   p_raw   - RAW temperature
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_pt500_temperature(const float32_t rth)
+th_status_t th_get_raw(const th_ch_t th, uint16_t * const p_raw)
 {
-    float32_t temp  = 0.0f;
+    th_status_t status = eTH_OK;
+
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_raw );
+    TH_ASSERT( th < eTH_NUM_OF );
+
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_raw )
+        &&  ( th < eTH_NUM_OF ))
+    {
+        *p_raw = th_pub_read( &g_th_ctx, th ).raw;
+    }
+    else
+    {
+        status = eTH_ERROR;
+    }
 
-    // Calculate temperature
-    temp = (float32_t) (( -TH_PT_DIN_EN60751_A + sqrtf( TH_PT_DIN_EN60751_AA - TH_PT_DIN_EN60751_4B * ( 1 - rth / 500.0f ))) / TH_PT_DIN_EN60751_2B );
-    
-    return temp;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Convert PT1000 resistance to degree C
-*
-* @note     Calculation of PT1000 according to DIN EN60751 standard.
-*           For futher details look at table: doc/pt1000_pt100_pt500_tables.xlsx 
+* @brief        Get temperature in deg C
 *
-* @param[in]    rth     - Resistance of PT1000 thermistor
-* @return       temp    - Calculated temperature
+* @param[in]    th      - Thermistor option
+* @param[out]   p_temp  - Pointer to temperature
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_pt1000_temperature(const float32_t rth)
+th_status_t th_get_degC(const th_ch_t th, float32_t * const p_temp)
 {
-    float32_t temp  = 0.0f;
+    th_status_t status = eTH_OK;
 
-    // Calculate temperature
-    temp = (float32_t) (( -TH_PT_DIN_EN60751_A + sqrtf( TH_PT_DIN_EN60751_AA - TH_PT_DIN_EN60751_4B * ( 1 - rth / 1000.0f ))) / TH_PT_DIN_EN60751_2B );
-    
-    return temp;
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_temp );
+    TH_ASSERT( th < eTH_NUM_OF );
+
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_temp )
+        &&  ( th < eTH_NUM_OF ))
+    {
+        *p_temp = TH_TEMP_TO_DEGC( th_pub_read( &g_th_ctx, th ).temp );
+    }
+    else
+    {
+        status = eTH_ERROR;
+    }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Calculate temperature
+* @brief        Get temperature in deg F
 *
 * @param[in]    th      - Thermistor option
-* @return       temp    - Calculated temperature
+* @param[out]   p_temp  - Pointer to temperature
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t th_calc_temperature(const th_ch_t th)
+th_status_t th_get_degF(const th_ch_t th, float32_t * const p_temp)
 {
-    float32_t temp = 0.0f;
+    th_status_t status = eTH_OK;
 
-    // Calculate thermistor resistance
-    g_th_data[th].res = th_calc_resistance( th );
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_temp );
+    TH_ASSERT( th < eTH_NUM_OF );
 
-    // Sensor type
-    switch( gp_cfg_table[th].type )
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_temp )
+        &&  ( th < eTH_NUM_OF ))
     {
-        case eTH_TYPE_NTC:
-            temp = th_calc_ntc_temperature( g_th_data[th].res, gp_cfg_table[th].ntc.beta, gp_cfg_table[th].ntc.nom_val );
-            break;
-
-        case eTH_TYPE_PT1000:
-            temp = th_calc_pt1000_temperature( g_th_data[th].res );
-            break;
-
-        case eTH_TYPE_PT100:
-            temp = th_calc_pt100_temperature( g_th_data[th].res );
-            break;
-
-        case eTH_TYPE_PT500:
-            temp = th_calc_pt500_temperature( g_th_data[th].res );
-            break;
-
-        default:
-            TH_ASSERT( 0 );
-            break;
+        // Conversion formula: T[°F] = 9/5[°F/°C] * T[°C] + 32[°F]
+        *p_temp = (float32_t)(( 1.8f * TH_TEMP_TO_DEGC( th_pub_read( &g_th_ctx, th ).temp )) + 32.0f );
+    }
+    else
+    {
+        status = eTH_ERROR;
     }
 
-    return temp;
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Init filters
+* @brief        Get temperature in kelvins
 *
 * @param[in]    th      - Thermistor option
+* @param[out]   p_temp  - Pointer to temperature
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static th_status_t th_init_filter(const th_ch_t th)
+th_status_t th_get_kelvin(const th_ch_t th, float32_t * const p_temp)
 {
     th_status_t status = eTH_OK;
 
-    #if ( 1 == TH_FILTER_EN )
-
-        // Init LPF 
-        if ( eFILTER_OK != filter_rc_init( &g_th_data[th].lpf, gp_cfg_table[th].lpf_fc, TH_HNDL_FREQ_HZ, 1, g_th_data[th].temp ))
-        {
-            status = eTH_ERROR;
-        }
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_temp );
+    TH_ASSERT( th < eTH_NUM_OF );
 
-    #endif
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_temp )
+        &&  ( th < eTH_NUM_OF ))
+    {
+        // Conversion formula: T[K] = T[°C] + 273.15[K]
+        *p_temp = (float32_t)( TH_TEMP_TO_DEGC( th_pub_read( &g_th_ctx, th ).temp ) + 273.15f );
+    }
+    else
+    {
+        status = eTH_ERROR;
+    }
 
     return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Handle thermistor status
+* @brief        Get temperature in milli deg C
+*
+* @note     With TH_FIXED_POINT_EN no floating point operation is used.
 *
 * @param[in]    th      - Thermistor option
-* @param[in]    temp    - Thermistor temperature
+* @param[out]   p_temp  - Pointer to temperature
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static th_status_t th_status_hndl(const th_ch_t th, const float32_t temp)
+th_status_t th_get_mdegC(const th_ch_t th, int32_t * const p_temp)
 {
     th_status_t status = eTH_OK;
 
-    // Check for status if:
-    //      1. Error type is floating
-    //  OR      2a. Error type is permanent
-    //      AND 2b. Status is OK 
-    if  (    ( eTH_ERR_FLOATING == gp_cfg_table[th].err_type )
-        ||  (( eTH_ERR_PERMANENT == gp_cfg_table[th].err_type ) && ( eTH_OK == g_th_data[th].status )))
-    {
-        // Above MAX range
-        if ( temp > gp_cfg_table[th].range.max )
-        {
-            // Sensor type
-            switch( gp_cfg_table[th].type )
-            {
-                case eTH_TYPE_NTC:
-                    status = eTH_ERROR_SHORT;
-                    break;
-
-                case eTH_TYPE_PT1000:
-                case eTH_TYPE_PT100:
-                case eTH_TYPE_PT500:
-                    status = eTH_ERROR_OPEN;
-                    break;
-
-                default:
-                    TH_ASSERT( 0 );
-                    break;
-            } 
-        }
-
-        // Bellow MIN range
-        else if (temp < gp_cfg_table[th].range.min )
-        {
-            // Sensor type
-            switch( gp_cfg_table[th].type )
-            {
-                case eTH_TYPE_NTC:
-                    status = eTH_ERROR_OPEN;
-                    break;
-
-                case eTH_TYPE_PT1000:
-                case eTH_TYPE_PT100:
-                case eTH_TYPE_PT500:
-                    status = eTH_ERROR_SHORT;
-                    break;
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_temp );
+    TH_ASSERT( th < eTH_NUM_OF );
 
-                default:
-                    TH_ASSERT( 0 );
-                    break;
-            }     
-        }
-    
-        // In NORMAL range
-        else
-        {
-            status = eTH_OK;
-        }
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_temp )
+        &&  ( th < eTH_NUM_OF ))
+    {
+        *p_temp = TH_TEMP_TO_MDEGC( th_pub_read( &g_th_ctx, th ).temp );
+    }
+    else
+    {
+        status = eTH_ERROR;
     }
 
     return status;
@@ -486,54 +3779,37 @@ static th_status_t th_status_hndl(const th_ch_t th, const float32_t temp)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Check configuration table
+* @brief        Get resistance of thermistor in Ohms
 *
-* @param[in]    p_cfg   - Configuration table
+* @param[in]    th      - Thermistor option
+* @param[out]   p_res   - Pointer to resistance
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static th_status_t th_check_cfg_table(const th_cfg_t * const p_cfg)
+th_status_t th_get_resistance(const th_ch_t th, float32_t * const p_res)
 {
     th_status_t status = eTH_OK;
 
-    if ( NULL != p_cfg )
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( NULL != p_res );
+    TH_ASSERT( th < eTH_NUM_OF );
+
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( NULL != p_res )
+        &&  ( th < eTH_NUM_OF ))
     {
-        // Check all entries
-        for ( uint32_t th = 0; th < eTH_NUM_OF; th++ )
-        {
-            /**
-             *  Check for correct configuration
-             *
-             *      1. LPF filter cutoff frequency shall be higher that 0 Hz
-             *      2. Valid HW configuration are:
-             *          - eTH_HW_LOW_SIDE  with eTH_HW_PULL_UP
-             *          - eTH_HW_HIGH_SIDE with eTH_HW_PULL_DOWN
-             *          - eTH_HW_LOW_SIDE  with eTH_HW_PULL_BOTH
-             *          - eTH_HW_HIGH_SIDE with eTH_HW_PULL_BOTH
-             *      3. Range: Max is larger than min value
-             */
-
-            if  (   ( p_cfg[th].lpf_fc > 0.0f )                                                                             // 1.
-                &&  (   (( eTH_HW_LOW_SIDE == p_cfg[th].hw.conn )   && ( eTH_HW_PULL_UP == p_cfg[th].hw.pull_mode ))        // 2.
-                    ||  (( eTH_HW_HIGH_SIDE == p_cfg[th].hw.conn )  && ( eTH_HW_PULL_DOWN == p_cfg[th].hw.pull_mode  ))
-                    ||  (( eTH_HW_LOW_SIDE == p_cfg[th].hw.conn )   && ( eTH_HW_PULL_BOTH == p_cfg[th].hw.pull_mode  ))
-                    ||  (( eTH_HW_HIGH_SIDE == p_cfg[th].hw.conn )  && ( eTH_HW_PULL_BOTH == p_cfg[th].hw.pull_mode  )))
-                &&  ( p_cfg[th].range.max > p_cfg[th].range.min ))                                                          // 3.
-            {
-                // Valid config
-            }
-            else
-            {
-                status = eTH_ERROR;
-                TH_DBG_PRINT( "ERROR: Invalid thermistor configuration at %d entry!", th );
-                break;
-            }
-        }
+        #if ( 1 == TH_LUT_EN )
+
+            // Resistance is not part of look-up table conversion
+            *p_res = th_calc_resistance( &g_th_coef[th], th_pub_read( &g_th_ctx, th ).raw );
+
+        #else
+            *p_res = th_pub_read( &g_th_ctx, th ).res;
+        #endif
     }
     else
     {
         status = eTH_ERROR;
-        TH_DBG_PRINT( "ERROR: Missing thermistor config table!" );
     }
 
     return status;
@@ -541,92 +3817,134 @@ static th_status_t th_check_cfg_table(const th_cfg_t * const p_cfg)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Limit floating point value
+* @brief        Get thermistor status
 *
-* @param[in]    in    - Input value to limit
-* @param[in]    min    - Minimum value limit
-* @param[in]    max    - Maximum value
-* @return       out    - Limited output value
+* @param[in]    th      - Thermistor option
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static inline float32_t th_limit_f32(const float32_t in, const float32_t min, const float32_t max)
+th_status_t th_get_status(const th_ch_t th)
 {
-    float32_t out = in;
+    th_status_t status = eTH_OK;
 
-    if ( in > max )
-    {
-        out = max;
-    }
-    else if ( in < min )
+    TH_ASSERT( true == g_th_ctx.is_init );
+    TH_ASSERT( th < eTH_NUM_OF );
+
+    if  (   ( true == g_th_ctx.is_init )
+        &&  ( th < eTH_NUM_OF ))
     {
-        out = min;
+        status = th_pub_read( &g_th_ctx, th ).status;
     }
     else
     {
-        out = in;
+        status = eTH_ERROR;
     }
 
-    return out;
+    return status;    
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
- * @} <!-- END GROUP -->
- */
+* @brief        Get samples of all thermistors
+*
+* @note     Samples of all thermistors are taken from the same handler
+*           call when TH_SNAPSHOT_EN is enabled.
+*
+*           Fault mask is optional and has TH_FAULT_MASK_WORDS words, 
+*           bit "th" is set when thermistor status is not eTH_OK. With 
+*           up to 32 thermistors any fault is checked by single compare
+*           to zero.
+*
+* @param[out]   p_samples   - Buffer of eTH_NUM_OF samples
+* @param[out]   p_fault     - Fault mask, can be NULL
+* @return       status      - Status of operation
+*/
 ////////////////////////////////////////////////////////////////////////////////
+th_status_t th_get_all(th_sample_t * const p_samples, uint32_t * const p_fault)
+{
+    return th_ctx_get_all( &g_th_ctx, p_samples, p_fault );
+}
 
 ////////////////////////////////////////////////////////////////////////////////
-/**
-*@addtogroup THERMISTOR_API
-* @{ <!-- BEGIN GROUP -->
+/*!
+* @brief        Convert buffer of RAW ADC codes to temperature
 *
-*     Following functions are part of API calls.
+* @note     Function is independent of module initialization and can be 
+*           used for offline processing of logged ADC codes. ADC maximum
+*           code is taken from ADC low level driver.
+*
+*           Conversion is done in two vectorizable passes over buffer: 
+*           resistance calculation and temperature calculation. NTC 
+*           temperature uses fast logarithm approximation.
+*
+*           NTC R-T table model (eTH_TYPE_NTC_TAB) is not supported, as
+*           its points are pre-calculated only at module init.
+*
+* @param[in]    p_cfg   - Thermistor configuration
+* @param[in]    p_raw   - Buffer of RAW ADC codes
+* @param[out]   p_temp  - Buffer of temperatures in degC
+* @param[in]    size    - Number of samples
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
+th_status_t th_convert_raw_batch(const th_cfg_t * const p_cfg, const uint16_t * const p_raw, float32_t * const p_temp, const uint32_t size)
+{
+    th_status_t status  = eTH_OK;
+    th_coef_t   coef    = {0};
+
+    TH_ASSERT( NULL != p_cfg );
+    TH_ASSERT( NULL != p_raw );
+    TH_ASSERT( NULL != p_temp );
+
+    if  (   ( NULL != p_cfg )
+        &&  ( NULL != p_raw )
+        &&  ( NULL != p_temp )
+        &&  ( eTH_TYPE_NTC_TAB != p_cfg->type )
+        &&  ( true == th_check_cfg( p_cfg )))
+    {
+        // Pre-calculate coefficients
+        th_init_coef( p_cfg, &coef );
+
+        // Convert
+        th_batch_calc_res( p_cfg, &coef, p_raw, p_temp, size );
+        th_batch_calc_temp( p_cfg, &coef, p_temp, size );
+    }
+    else
+    {
+        status = eTH_ERROR;
+    }
+
+    return status;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Init thermistors
+* @brief        Get size of thermistor context storage
 *
-* @return       status - Status of operation
+* @note     Size depends on number of thermistors and, with TH_NTC_TAB_EN,
+*           on number of R-T table points in configuration table.
+*
+* @param[in]    p_cfg   - Configuration table
+* @param[in]    num_of  - Number of entries in configuration table
+* @param[out]   p_size  - Size of context storage in bytes
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_init(void)
+th_status_t th_ctx_get_size(const th_cfg_t * const p_cfg, const uint32_t num_of, uint32_t * const p_size)
 {
     th_status_t status = eTH_OK;
 
-    if ( false == gb_is_init )
-    {
-        // Get configuration table
-        gp_cfg_table = th_cfg_get_table();
-
-        // Check configuration table
-        status = th_check_cfg_table( gp_cfg_table );
-        
-        // Configuration table missing
-        if ( eTH_OK == status )
-        {
-            // Init all thermistors
-            for ( uint32_t th = 0; th < eTH_NUM_OF; th++ )
-            {
-                // Get current temperature
-                g_th_data[th].temp      = th_calc_temperature( th );
-                g_th_data[th].temp_filt = g_th_data[th].temp;
-                
-                // Init filter
-                if ( eTH_OK != th_init_filter( th ))
-                {
-                    status = eTH_ERROR;
-                    break;
-                }
-            }
-        }
+    TH_ASSERT( NULL != p_cfg );
+    TH_ASSERT( NULL != p_size );
 
-        // Init success
-        if ( eTH_OK == status )
-        {
-            gb_is_init = true;
-        }
+    if  (   ( NULL != p_cfg )
+        &&  ( NULL != p_size ))
+    {
+        *p_size = th_ctx_layout( p_cfg, num_of, NULL );
+    }
+    else
+    {
+        status = eTH_ERROR;
     }
 
     return status;
@@ -634,26 +3952,51 @@ th_status_t th_init(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        De-init thermistors
+* @brief        Init thermistor context
 *
-* @return       status - Status of operation
+* @note     Context storage is owned by caller, its size is given by 
+*           th_ctx_get_size() and it shall be aligned to at least 8 bytes. 
+*           Configuration table must stay valid for context lifetime.
+*
+*           Contexts do not share any mutable state, therefore different
+*           contexts can be handled from different threads. Single context
+*           shall be handled from single thread only, getters can be 
+*           called from any thread with TH_SNAPSHOT_EN.
+*
+* @param[out]   p_ctx   - Thermistor context storage
+* @param[in]    p_cfg   - Configuration table
+* @param[in]    num_of  - Number of entries in configuration table
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_deinit(void)
+th_status_t th_ctx_init(th_ctx_t * const p_ctx, const th_cfg_t * const p_cfg, const uint32_t num_of)
 {
     th_status_t status = eTH_OK;
 
-    if ( true == gb_is_init )
+    TH_ASSERT( NULL != p_ctx );
+    TH_ASSERT( NULL != p_cfg );
+    TH_ASSERT( num_of > 0U );
+
+    if  (   ( NULL != p_ctx )
+        &&  ( NULL != p_cfg )
+        &&  ( num_of > 0U ))
     {
-        // Reset all thermistor values
-        for ( uint32_t th = 0; th < eTH_NUM_OF; th++ )
-        {
-            // Get current temperature
-            g_th_data[th].temp      = 0.0f;
-            g_th_data[th].temp_filt = 0.0f;
-        }
+        // Clear and layout storage
+        memset( p_ctx, 0, th_ctx_layout( p_cfg, num_of, NULL ));
+        (void) th_ctx_layout( p_cfg, num_of, p_ctx );
 
-        gb_is_init = false;
+        p_ctx->p_cfg    = p_cfg;
+        p_ctx->num_of   = num_of;
+
+        #if ( 1 == TH_SNAPSHOT_EN )
+            atomic_init( &p_ctx->pub_seq, 0U );
+        #endif
+
+        status = th_ctx_start( p_ctx );
+    }
+    else
+    {
+        status = eTH_ERROR;
     }
 
     return status;
@@ -661,19 +4004,37 @@ th_status_t th_deinit(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Get initialization flag
+* @brief        De-init thermistor context
 *
-* @param[out]   p_is_init   - Initialization flag
-* @return       status      - Status of operation
+* @note     Context storage can be released by caller afterwards.
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_is_init(bool * const p_is_init)
+th_status_t th_ctx_deinit(th_ctx_t * const p_ctx)
 {
     th_status_t status = eTH_OK;
 
-    if ( NULL != p_is_init )
+    TH_ASSERT( NULL != p_ctx );
+
+    if ( NULL != p_ctx )
     {
-        *p_is_init = gb_is_init;
+        // Reset all thermistor values
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            p_ctx->data.p_temp[th]      = 0;
+            p_ctx->data.p_temp_filt[th] = 0;
+        }
+
+        // Restart time-sliced handler
+        #if ( 1 == TH_HNDL_BUDGET_EN )
+            p_ctx->hndl_next    = 0U;
+            p_ctx->hndl_lag     = 0U;
+        #endif
+
+        th_pub_write( p_ctx );
+        p_ctx->is_init = false;
     }
     else
     {
@@ -685,35 +4046,60 @@ th_status_t th_is_init(bool * const p_is_init)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Thermistor main handler
+* @brief        Thermistor context main handler
 *
-* @return       status - Status of operation
+* @param[in]    p_ctx   - Thermistor context
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_hndl(void)
+th_status_t th_ctx_hndl(th_ctx_t * const p_ctx)
 {
     th_status_t status = eTH_OK;
 
-    TH_ASSERT( true == gb_is_init );
+    TH_ASSERT( NULL != p_ctx );
+    TH_ASSERT( true == p_ctx->is_init );
 
-    if ( true == gb_is_init )
+    if  (   ( NULL != p_ctx )
+        &&  ( true == p_ctx->is_init ))
     {
+        #if ( 1 == TH_PERF_EN )
+            const uint32_t start = (uint32_t) TH_GET_TIMESTAMP();
+        #endif
+
         // Handle all thermistors
-        for ( uint32_t th = 0; th < eTH_NUM_OF; th++ )
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
         {
-            // Get temperature
-            g_th_data[th].temp = th_calc_temperature( th );            
+            if ( true == th_sched_is_due( p_ctx, th ))
+            {
+                uint16_t raw = 0U;
 
-            // Update filter
-            #if ( 1 == TH_FILTER_EN )
-                 (void) filter_rc_hndl( g_th_data[th].lpf, g_th_data[th].temp, &g_th_data[th].temp_filt );
-            #else
-                g_th_data[th].temp_filt = g_th_data[th].temp;
-            #endif
+                // Get raw adc value
+                adc_get_raw( p_ctx->p_adc_ch[th], &raw );
 
-            // Check status on filtered temperature
-            g_th_data[th].status = th_status_hndl( th, g_th_data[th].temp_filt );
+                // Process sample
+                th_sample( p_ctx, th, raw );
+            }
         }
+
+        // Check status on filtered temperature
+        th_status_hndl( p_ctx );
+
+        // Check alarms on filtered temperature
+        #if ( 1 == TH_ALARM_EN )
+            th_alarm_hndl( p_ctx );
+        #endif
+
+        // Publish to getters
+        th_pub_write( p_ctx );
+
+        // Report events on published data
+        #if ( 1 == TH_EVENT_EN )
+            th_evt_hndl( p_ctx );
+        #endif
+
+        #if ( 1 == TH_PERF_EN )
+            th_perf_add( &p_ctx->perf[eTH_PERF_HNDL], ((uint32_t) TH_GET_TIMESTAMP() - start ));
+        #endif
     }
     else
     {
@@ -725,27 +4111,74 @@ th_status_t th_hndl(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Get RAW temperature in ADC codes
+* @brief        Thermistor context handler of fresh RAW ADC samples
 *
-* @param[in]    th      - Thermistor option
-* @param[out]   p_raw   - RAW temperature
-* @return       status  - Status of operation
+* @note     Event driven alternative to th_ctx_hndl(), intended to be called
+*           from ADC scan complete or DMA half/full transfer interrupt, or
+*           with samples received from remote board. Buffer holds samples 
+*           of consecutive ADC channels, starting with "ch_first". Only 
+*           thermistors measured on those channels are processed, others 
+*           are left untouched.
+*
+*           Sample rate of each thermistor shall be equal to handler
+*           period (TH_HNDL_PERIOD_S), thermistor update period is then
+*           applied the same way as in th_ctx_hndl().
+*
+* @param[in]    p_ctx       - Thermistor context
+* @param[in]    ch_first    - ADC channel of first sample in buffer
+* @param[in]    p_raw       - Buffer of RAW ADC codes
+* @param[in]    size        - Number of samples in buffer
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_raw(const th_ch_t th, uint16_t * const p_raw)
+th_status_t th_ctx_hndl_raw(th_ctx_t * const p_ctx, const adc_ch_t ch_first, const uint16_t * const p_raw, const uint32_t size)
 {
     th_status_t status = eTH_OK;
 
-    TH_ASSERT( true == gb_is_init );
+    TH_ASSERT( NULL != p_ctx );
+    TH_ASSERT( true == p_ctx->is_init );
     TH_ASSERT( NULL != p_raw );
-    TH_ASSERT( th < eTH_NUM_OF );
 
-    if  (   ( true == gb_is_init )
-        &&  ( NULL != p_raw )
-        &&  ( th < eTH_NUM_OF ))
+    if  (   ( NULL != p_ctx )
+        &&  ( true == p_ctx->is_init )
+        &&  ( NULL != p_raw ))
     {
-        // Get raw adc value
-        adc_get_raw( gp_cfg_table[th].adc_ch, p_raw );
+        #if ( 1 == TH_PERF_EN )
+            const uint32_t start = (uint32_t) TH_GET_TIMESTAMP();
+        #endif
+
+        // Handle thermistors with fresh sample
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            const uint32_t idx = ((uint32_t) p_ctx->p_adc_ch[th] - (uint32_t) ch_first );
+
+            // NOTE: Channels bellow first one wrap around to large index
+            if  (   ( idx < size )
+                &&  ( true == th_sched_is_due( p_ctx, th )))
+            {
+                th_sample( p_ctx, th, p_raw[idx] );
+            }
+        }
+
+        // Check status on filtered temperature
+        th_status_hndl( p_ctx );
+
+        // Check alarms on filtered temperature
+        #if ( 1 == TH_ALARM_EN )
+            th_alarm_hndl( p_ctx );
+        #endif
+
+        // Publish to getters
+        th_pub_write( p_ctx );
+
+        // Report events on published data
+        #if ( 1 == TH_EVENT_EN )
+            th_evt_hndl( p_ctx );
+        #endif
+
+        #if ( 1 == TH_PERF_EN )
+            th_perf_add( &p_ctx->perf[eTH_PERF_HNDL], ((uint32_t) TH_GET_TIMESTAMP() - start ));
+        #endif
     }
     else
     {
@@ -755,28 +4188,177 @@ th_status_t th_get_raw(const th_ch_t th, uint16_t * const p_raw)
     return status;
 }
 
+#if ( 1 == TH_HNDL_BUDGET_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Time-sliced handler of context
+    *
+    * @note     Replacement of th_ctx_hndl() with bounded execution time,
+    *           shall be called at TH_HNDL_PERIOD_S period. Each call adds
+    *           one handler period of work, thermistors are then processed 
+    *           until all pending work is done or time budget runs out. 
+    *           Next call continues with next thermistor. At least one 
+    *           thermistor is processed per call.
+    *
+    *           Status, alarm, publish and event passes over all 
+    *           thermistors are not covered by budget. They are done 
+    *           only by call that completes handler period, so that 
+    *           other calls stay within budget.
+    *
+    *           Use th_ctx_get_hndl_lag() to check if configured 
+    *           thermistors can be sustained.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    budget  - Time budget in TH_GET_TIMESTAMP() units
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_hndl_budget(th_ctx_t * const p_ctx, const uint32_t budget)
+    {
+        th_status_t     status  = eTH_OK;
+        const uint32_t  start   = (uint32_t) TH_GET_TIMESTAMP();
+
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init ))
+        {
+            bool is_period_done = false;
+
+            // New handler period
+            if ( p_ctx->hndl_lag < UINT32_MAX )
+            {
+                p_ctx->hndl_lag++;
+            }
+
+            do
+            {
+                const uint32_t th = p_ctx->hndl_next;
+
+                if ( true == th_sched_is_due( p_ctx, th ))
+                {
+                    uint16_t raw = 0U;
+
+                    // Get raw adc value
+                    adc_get_raw( p_ctx->p_adc_ch[th], &raw );
+
+                    // Process sample
+                    th_sample( p_ctx, th, raw );
+                }
+
+                // Handler period done
+                p_ctx->hndl_next++;
+                if ( p_ctx->hndl_next >= p_ctx->num_of )
+                {
+                    p_ctx->hndl_next = 0U;
+                    p_ctx->hndl_lag--;
+                    is_period_done = true;
+                }
+            }
+            while   (   ( p_ctx->hndl_lag > 0U )
+                    &&  (((uint32_t) TH_GET_TIMESTAMP() - start ) < budget ));
+
+            // Passes over all thermistors once per handler period
+            if ( true == is_period_done )
+            {
+                // Check status on filtered temperature
+                th_status_hndl( p_ctx );
+
+                // Check alarms on filtered temperature
+                #if ( 1 == TH_ALARM_EN )
+                    th_alarm_hndl( p_ctx );
+                #endif
+
+                // Publish to getters
+                th_pub_write( p_ctx );
+
+                // Report events on published data
+                #if ( 1 == TH_EVENT_EN )
+                    th_evt_hndl( p_ctx );
+                #endif
+            }
+
+            #if ( 1 == TH_PERF_EN )
+                th_perf_add( &p_ctx->perf[eTH_PERF_HNDL], ((uint32_t) TH_GET_TIMESTAMP() - start ));
+            #endif
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get time-sliced handler lag of context
+    *
+    * @note     Lag is number of handler periods, which are not yet fully
+    *           processed. Lag of 1 after th_ctx_hndl_budget() means that 
+    *           processing of current period continues on next call, 
+    *           steadily growing lag means that configured thermistors 
+    *           cannot be processed at TH_HNDL_PERIOD_S with given budget.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[out]   p_lag   - Number of pending handler periods
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_get_hndl_lag(th_ctx_t * const p_ctx, uint32_t * const p_lag)
+    {
+        th_status_t status = eTH_OK;
+
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( NULL != p_lag );
+
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( NULL != p_lag ))
+        {
+            *p_lag = p_ctx->hndl_lag;
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
+    }
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Get temperature in deg C
+* @brief        Get sample of single thermistor of context
 *
-* @param[in]    th      - Thermistor option
-* @param[out]   p_temp  - Pointer to temperature
-* @return       status  - Status of operation
+* @param[in]    p_ctx       - Thermistor context
+* @param[in]    th          - Thermistor index in configuration table
+* @param[out]   p_sample    - Thermistor sample
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_degC(const th_ch_t th, float32_t * const p_temp)
+th_status_t th_ctx_get_sample(th_ctx_t * const p_ctx, const uint32_t th, th_sample_t * const p_sample)
 {
     th_status_t status = eTH_OK;
 
-    TH_ASSERT( true == gb_is_init );
-    TH_ASSERT( NULL != p_temp );
-    TH_ASSERT( th < eTH_NUM_OF );
+    TH_ASSERT( NULL != p_ctx );
+    TH_ASSERT( true == p_ctx->is_init );
+    TH_ASSERT( NULL != p_sample );
+    TH_ASSERT( th < p_ctx->num_of );
 
-    if  (   ( true == gb_is_init )
-        &&  ( NULL != p_temp )
-        &&  ( th < eTH_NUM_OF ))
+    if  (   ( NULL != p_ctx )
+        &&  ( true == p_ctx->is_init )
+        &&  ( NULL != p_sample )
+        &&  ( th < p_ctx->num_of ))
     {
-        *p_temp = g_th_data[th].temp;
+        const th_pub_t pub = th_pub_read( p_ctx, th );
+
+        th_pub_pack( th, &pub, p_sample, NULL );
+        th_pub_pack_res( p_ctx, th, p_sample );
     }
     else
     {
@@ -788,27 +4370,42 @@ th_status_t th_get_degC(const th_ch_t th, float32_t * const p_temp)
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief        Get temperature in deg F
+* @brief        Get samples of all thermistors of context
 *
-* @param[in]    th      - Thermistor option
-* @param[out]   p_temp  - Pointer to temperature
-* @return       status  - Status of operation
+* @note     Samples of all thermistors are taken from the same handler
+*           call when TH_SNAPSHOT_EN is enabled.
+*
+*           Fault mask is optional and has TH_FAULT_MASK_WORDS_OF( num_of ) 
+*           words, bit "th" is set when thermistor status is not eTH_OK.
+*
+* @param[in]    p_ctx       - Thermistor context
+* @param[out]   p_samples   - Buffer of samples, one per configuration entry
+* @param[out]   p_fault     - Fault mask, can be NULL
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_degF(const th_ch_t th, float32_t * const p_temp)
+th_status_t th_ctx_get_all(th_ctx_t * const p_ctx, th_sample_t * const p_samples, uint32_t * const p_fault)
 {
     th_status_t status = eTH_OK;
 
-    TH_ASSERT( true == gb_is_init );
-    TH_ASSERT( NULL != p_temp );
-    TH_ASSERT( th < eTH_NUM_OF );
+    TH_ASSERT( NULL != p_ctx );
+    TH_ASSERT( true == p_ctx->is_init );
+    TH_ASSERT( NULL != p_samples );
 
-    if  (   ( true == gb_is_init )
-        &&  ( NULL != p_temp )
-        &&  ( th < eTH_NUM_OF ))
+    if  (   ( NULL != p_ctx )
+        &&  ( true == p_ctx->is_init )
+        &&  ( NULL != p_samples ))
     {
-        // Conversion formula: T[°F] = 9/5[°F/°C] * T[°C] + 32[°F]
-        *p_temp = (float32_t)(( 1.8f * g_th_data[th].temp ) + 32.0f );
+        th_pub_all_t all = { .p_samples = p_samples, .p_fault = p_fault };
+
+        th_pub_read_with( p_ctx, th_pub_copy_all, &all );
+
+        #if ( 1 == TH_LUT_EN )
+            for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+            {
+                th_pub_pack_res( p_ctx, th, &p_samples[th] );
+            }
+        #endif
     }
     else
     {
@@ -818,121 +4415,340 @@ th_status_t th_get_degF(const th_ch_t th, float32_t * const p_temp)
     return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/*!
-* @brief        Get temperature in kelvins
-*
-* @param[in]    th      - Thermistor option
-* @param[out]   p_temp  - Pointer to temperature
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_kelvin(const th_ch_t th, float32_t * const p_temp)
-{
-    th_status_t status = eTH_OK;
+#if ( 1 == TH_PERF_EN )
 
-    TH_ASSERT( true == gb_is_init );
-    TH_ASSERT( NULL != p_temp );
-    TH_ASSERT( th < eTH_NUM_OF );
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get execution time statistics of context
+    *
+    * @note     Statistics are updated by handler, read them from the same 
+    *           thread or accept slightly inconsistent values.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    id      - Measured code section
+    * @param[out]   p_stats - Execution time statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_get_perf_stats(th_ctx_t * const p_ctx, const th_perf_id_t id, th_perf_stats_t * const p_stats)
+    {
+        th_status_t status = eTH_OK;
 
-    if  (   ( true == gb_is_init )
-        &&  ( NULL != p_temp )
-        &&  ( th < eTH_NUM_OF ))
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( id < eTH_PERF_NUM_OF );
+        TH_ASSERT( NULL != p_stats );
+
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( id < eTH_PERF_NUM_OF )
+            &&  ( NULL != p_stats ))
+        {
+            const th_perf_t * const p_perf = &p_ctx->perf[id];
+
+            p_stats->cnt    = p_perf->cnt;
+            p_stats->min    = ( p_perf->cnt > 0U ) ? p_perf->min : 0U;
+            p_stats->max    = p_perf->max;
+            p_stats->mean   = ( p_perf->cnt > 0U ) ? (uint32_t) ( p_perf->sum / p_perf->cnt ) : 0U;
+
+            memcpy( p_stats->hist, p_perf->hist, sizeof( p_stats->hist ));
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get execution time statistics
+    *
+    * @param[in]    id      - Measured code section
+    * @param[out]   p_stats - Execution time statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_perf_stats(const th_perf_id_t id, th_perf_stats_t * const p_stats)
     {
-        // Conversion formula: T[K] = T[°C] + 273.15[K]
-        *p_temp = (float32_t)( g_th_data[th].temp + 273.15f );
+        return th_ctx_get_perf_stats( &g_th_ctx, id, p_stats );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Reset execution time statistics
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_reset_perf_stats(void)
+    {
+        th_status_t status = eTH_OK;
+
+        TH_ASSERT( true == g_th_ctx.is_init );
+
+        if ( true == g_th_ctx.is_init )
+        {
+            th_perf_reset( &g_th_ctx );
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Print execution time statistics
+    *
+    * @note     Printed over TH_DBG_PRINT, therefore TH_DEBUG_EN shall be 
+    *           enabled. Only measured code sections and non-empty 
+    *           histogram bins are printed.
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_print_perf_stats(void)
+    {
+        th_status_t                 status = eTH_OK;
+        static const char * const   name[eTH_PERF_NUM_OF] =
+        {
+            [eTH_PERF_HNDL]         = "hndl",
+            [eTH_PERF_CONV_NTC]     = "ntc",
+            [eTH_PERF_CONV_NTC_SH]  = "ntc_sh",
+            [eTH_PERF_CONV_NTC_TAB] = "ntc_tab",
+            [eTH_PERF_CONV_PT]      = "pt",
+            [eTH_PERF_CONV_LUT]     = "lut",
+        };
+
+        for ( uint32_t id = 0; ( eTH_OK == status ) && ( id < eTH_PERF_NUM_OF ); id++ )
+        {
+            th_perf_stats_t stats = {0};
+
+            status = th_get_perf_stats((th_perf_id_t) id, &stats );
+
+            if  (   ( eTH_OK == status )
+                &&  ( stats.cnt > 0U ))
+            {
+                TH_DBG_PRINT( "TH perf %s: cnt=%u min=%u max=%u mean=%u", name[id], (unsigned) stats.cnt, (unsigned) stats.min, (unsigned) stats.max, (unsigned) stats.mean );
+
+                for ( uint32_t bin = 0; bin < TH_PERF_HIST_SIZE; bin++ )
+                {
+                    if ( stats.hist[bin] > 0U )
+                    {
+                        TH_DBG_PRINT( "    >= 2^%u: %u", (unsigned) bin, (unsigned) stats.hist[bin] );
+                    }
+                }
+            }
+        }
+
+        (void) name;
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get next event of context
+    *
+    * @note     Events are kept in lock-free single producer, single 
+    *           consumer queue. Can be called from other task or ISR than
+    *           handler, but only from one.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[out]   p_event - Thermistor event
+    * @return       status  - Status of operation, eTH_ERROR when queue is empty
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_get_event(th_ctx_t * const p_ctx, th_event_t * const p_event)
+    {
+        th_status_t status = eTH_OK;
+
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( NULL != p_event );
+
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( NULL != p_event ))
+        {
+            th_evt_t * const    p_evt   = &p_ctx->evt;
+            const uint32_t      rd      = atomic_load_explicit( &p_evt->rd, memory_order_relaxed );
+            const uint32_t      wr      = atomic_load_explicit( &p_evt->wr, memory_order_acquire );
+
+            if ( rd != wr )
+            {
+                *p_event = p_evt->queue[ rd & ( TH_EVENT_QUEUE_SIZE - 1U ) ];
+                atomic_store_explicit( &p_evt->rd, ( rd + 1U ), memory_order_release );
+            }
+            else
+            {
+                status = eTH_ERROR;
+            }
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
     }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Register event callback of context
+    *
+    * @note     Callback is called from handler context after event is 
+    *           queued, keep it short (e.g. give semaphore to consumer).
+    *           NULL un-registers callback.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    pf_cb   - Event callback
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_set_event_cb(th_ctx_t * const p_ctx, const pf_th_event_cb_t pf_cb)
     {
-        status = eTH_ERROR;
-    }
+        th_status_t status = eTH_OK;
 
-    return status;
-}
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
 
-////////////////////////////////////////////////////////////////////////////////
-/*!
-* @brief        Get resistance of thermistor in Ohms
-*
-* @param[in]    th      - Thermistor option
-* @param[out]   p_res   - Pointer to resistance
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_resistance(const th_ch_t th, float32_t * const p_res)
-{
-    th_status_t status = eTH_OK;
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init ))
+        {
+            p_ctx->evt.pf_cb = pf_cb;
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
 
-    TH_ASSERT( true == gb_is_init );
-    TH_ASSERT( NULL != p_res );
-    TH_ASSERT( th < eTH_NUM_OF );
+        return status;
+    }
 
-    if  (   ( true == gb_is_init )
-        &&  ( NULL != p_res )
-        &&  ( th < eTH_NUM_OF ))
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get next thermistor event
+    *
+    * @param[out]   p_event - Thermistor event
+    * @return       status  - Status of operation, eTH_ERROR when queue is empty
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_event(th_event_t * const p_event)
     {
-        *p_res = g_th_data[th].res;
+        return th_ctx_get_event( &g_th_ctx, p_event );
     }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Register thermistor event callback
+    *
+    * @param[in]    pf_cb   - Event callback
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_set_event_cb(const pf_th_event_cb_t pf_cb)
     {
-        status = eTH_ERROR;
+        return th_ctx_set_event_cb( &g_th_ctx, pf_cb );
     }
 
-    return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/*!
-* @brief        Get thermistor status
-*
-* @param[in]    th      - Thermistor option
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-th_status_t th_get_status(const th_ch_t th)
-{
-    th_status_t status = eTH_OK;
+#endif
 
-    TH_ASSERT( true == gb_is_init );
-    TH_ASSERT( th < eTH_NUM_OF );
+#if ( 1 == TH_ALARM_EN )
 
-    if  (   ( true == gb_is_init )
-        &&  ( th < eTH_NUM_OF ))
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Copy published alarms of all thermistors into alarm mask
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    p_data  - Published thermistor data
+    * @param[out]   p_arg   - Alarm mask
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_alarm_copy_mask(const th_ctx_t * const p_ctx, const th_data_t * const p_data, void * const p_arg)
     {
-        status = g_th_data[th].status;
+        uint32_t * const    p_mask      = (uint32_t*) p_arg;
+        const uint32_t      mask_words  = TH_ALARM_MASK_WORDS_OF( p_ctx->num_of );
+
+        for ( uint32_t w = 0; w < mask_words; w++ )
+        {
+            p_mask[w] = 0U;
+        }
+
+        for ( uint32_t th = 0; th < p_ctx->num_of; th++ )
+        {
+            p_mask[ th >> 3U ] |= (( p_data->p_alarm[th] & TH_ALARM_BITS_MASK ) << (( th & 7U ) * 4U ));
+        }
     }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get alarm mask of all thermistors of context
+    *
+    * @note     Mask has TH_ALARM_MASK_WORDS_OF( num_of ) words, each 
+    *           thermistor takes 4 bits of th_alarm_t at bit 
+    *           "4 * ( th % 8 )" of word "th / 8". Alarms of all 
+    *           thermistors are taken from the same handler call when 
+    *           TH_SNAPSHOT_EN is enabled.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[out]   p_mask  - Alarm mask
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_ctx_get_alarm_all(th_ctx_t * const p_ctx, uint32_t * const p_mask)
     {
-        status = eTH_ERROR;
-    }
+        th_status_t status = eTH_OK;
 
-    return status;    
-}
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( NULL != p_mask );
 
-#if ( 1 == TH_FILTER_EN )
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( NULL != p_mask ))
+        {
+            th_pub_read_with( p_ctx, th_alarm_copy_mask, p_mask );
+        }
+        else
+        {
+            status = eTH_ERROR;
+        }
+
+        return status;
+    }
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Get filtered temperature in deg C
+    * @brief        Get active alarms of thermistor
     *
-    * @param[in]    th      - Thermistor option
-    * @param[out]   p_temp  - Pointer to temperature
+    * @param[in]    th      - Thermistor enumeration
+    * @param[out]   p_alarm - Active alarms, th_alarm_t bitmask
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_get_degC_filt(const th_ch_t th, float32_t * const p_temp)
+    th_status_t th_get_alarm(const th_ch_t th, uint8_t * const p_alarm)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
-        TH_ASSERT( NULL != p_temp );
+        TH_ASSERT( true == g_th_ctx.is_init );
         TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( NULL != p_alarm );
 
-        if  (   ( true == gb_is_init )
-            &&  ( NULL != p_temp )
-            &&  ( th < eTH_NUM_OF ))
+        if  (   ( true == g_th_ctx.is_init )
+            &&  ( th < eTH_NUM_OF )
+            &&  ( NULL != p_alarm ))
         {
-            *p_temp = g_th_data[th].temp_filt;
+            *p_alarm = (uint8_t) th_pub_read( &g_th_ctx, th ).alarm;
         }
         else
         {
@@ -944,27 +4760,46 @@ th_status_t th_get_status(const th_ch_t th)
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Get filtered temperature in deg F
+    * @brief        Get alarm mask of all thermistors
     *
-    * @param[in]    th      - Thermistor option
+    * @param[out]   p_mask  - Alarm mask of TH_ALARM_MASK_WORDS words
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_alarm_all(uint32_t * const p_mask)
+    {
+        return th_ctx_get_alarm_all( &g_th_ctx, p_mask );
+    }
+
+#endif
+
+#if ( 1 == TH_FILTER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get filtered temperature of context in deg C
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index in configuration table
     * @param[out]   p_temp  - Pointer to temperature
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_get_degF_filt(const th_ch_t th, float32_t * const p_temp)
+    th_status_t th_ctx_get_degC_filt(th_ctx_t * const p_ctx, const uint32_t th, float32_t * const p_temp)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
         TH_ASSERT( NULL != p_temp );
-        TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( th < p_ctx->num_of );
 
-        if  (   ( true == gb_is_init )
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
             &&  ( NULL != p_temp )
-            &&  ( th < eTH_NUM_OF ))
+            &&  ( th < p_ctx->num_of ))
         {
-            // Conversion formula: T[°F] = 9/5[°F/°C] * T[°C] + 32[°F]
-            *p_temp = (float32_t)(( 1.8f * g_th_data[th].temp_filt ) + 32.0f );
+            *p_temp = TH_TEMP_TO_DEGC( th_pub_read( p_ctx, th ).temp_filt );
         }
         else
         {
@@ -976,27 +4811,31 @@ th_status_t th_get_status(const th_ch_t th)
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Get filtered temperature in kelvin
+    * @brief        Get filtered temperature of context in milli deg C
     *
-    * @param[in]    th      - Thermistor option
+    * @note     With TH_FIXED_POINT_EN no floating point operation is used.
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index in configuration table
     * @param[out]   p_temp  - Pointer to temperature
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_get_kelvin_filt(const th_ch_t th, float32_t * const p_temp)
+    th_status_t th_ctx_get_mdegC_filt(th_ctx_t * const p_ctx, const uint32_t th, int32_t * const p_temp)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
         TH_ASSERT( NULL != p_temp );
-        TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( th < p_ctx->num_of );
 
-        if  (   ( true == gb_is_init )
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
             &&  ( NULL != p_temp )
-            &&  ( th < eTH_NUM_OF ))
+            &&  ( th < p_ctx->num_of ))
         {
-            // Conversion formula: T[K] = T[°C] + 273.15[K]
-            *p_temp = (float32_t)( g_th_data[th].temp_filt + 273.15f );
+            *p_temp = TH_TEMP_TO_MDEGC( th_pub_read( p_ctx, th ).temp_filt );
         }
         else
         {
@@ -1008,29 +4847,29 @@ th_status_t th_get_status(const th_ch_t th)
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Set LPF cuttoff frequency
+    * @brief        Set LPF cuttoff frequency of thermistor of context
     *
-    * @param[in]    th      - Thermistor option
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index in configuration table
     * @param[in]    fc      - Cutoff frequency of LPF
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_set_lpf_fc(const th_ch_t th, const float32_t fc)
+    th_status_t th_ctx_set_lpf_fc(th_ctx_t * const p_ctx, const uint32_t th, const float32_t fc)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
-        TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( th < p_ctx->num_of );
         TH_ASSERT( fc > 0.0f );
 
-        if  (   ( true == gb_is_init )
-            &&  ( th < eTH_NUM_OF )
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( th < p_ctx->num_of )
             &&  ( fc > 0.0f ))
         {
-            if ( eFILTER_OK != filter_rc_fc_set( g_th_data[th].lpf, fc ))
-            {
-                status = eTH_ERROR;
-            }
+            th_lpf_set_fc( p_ctx, th, fc );
         }
         else
         {
@@ -1042,26 +4881,29 @@ th_status_t th_get_status(const th_ch_t th)
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Get LPF cuttoff frequency
+    * @brief        Get LPF cuttoff frequency of thermistor of context
     *
-    * @param[in]    th      - Thermistor option
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index in configuration table
     * @param[out]   p_fc    - Pointer to LPF cutoff frequency
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_get_lpf_fc(const th_ch_t th, float32_t * const p_fc)
+    th_status_t th_ctx_get_lpf_fc(th_ctx_t * const p_ctx, const uint32_t th, float32_t * const p_fc)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
         TH_ASSERT( NULL != p_fc );
-        TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( th < p_ctx->num_of );
 
-        if  (   ( true == gb_is_init )
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
             &&  ( NULL != p_fc )
-            &&  ( th < eTH_NUM_OF ))
+            &&  ( th < p_ctx->num_of ))
         {
-            (void) filter_rc_fc_get( g_th_data[th].lpf, p_fc );
+            *p_fc = p_ctx->lpf.p_fc[th];
         }
         else
         {
@@ -1073,24 +4915,27 @@ th_status_t th_get_status(const th_ch_t th)
 
     ////////////////////////////////////////////////////////////////////////////////
     /*!
-    * @brief        Reset LPF filter
+    * @brief        Reset LPF filter of thermistor of context
     *
-    * @param[in]    th      - Thermistor option
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index in configuration table
     * @param[in]    temp    - Temperature value to reset to
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    th_status_t th_reset_lpf(const th_ch_t th, const float32_t temp)
+    th_status_t th_ctx_reset_lpf(th_ctx_t * const p_ctx, const uint32_t th, const float32_t temp)
     {
         th_status_t status = eTH_OK;
 
-        TH_ASSERT( true == gb_is_init );
-        TH_ASSERT( th < eTH_NUM_OF );
+        TH_ASSERT( NULL != p_ctx );
+        TH_ASSERT( true == p_ctx->is_init );
+        TH_ASSERT( th < p_ctx->num_of );
 
-        if  (   ( true == gb_is_init )
-            &&  ( th < eTH_NUM_OF ))
+        if  (   ( NULL != p_ctx )
+            &&  ( true == p_ctx->is_init )
+            &&  ( th < p_ctx->num_of ))
         {
-            (void) filter_rc_reset( g_th_data[th].lpf, temp );
+            th_lpf_reset( p_ctx, th, TH_DEGC_TO_TEMP( temp ));
         }
         else
         {
@@ -1100,6 +4945,122 @@ th_status_t th_get_status(const th_ch_t th)
         return status;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get filtered temperature in deg C
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[out]   p_temp  - Pointer to temperature
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_degC_filt(const th_ch_t th, float32_t * const p_temp)
+    {
+        return th_ctx_get_degC_filt( &g_th_ctx, th, p_temp );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get filtered temperature in deg F
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[out]   p_temp  - Pointer to temperature
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_degF_filt(const th_ch_t th, float32_t * const p_temp)
+    {
+        const th_status_t status = th_ctx_get_degC_filt( &g_th_ctx, th, p_temp );
+
+        if ( eTH_OK == status )
+        {
+            // Conversion formula: T[°F] = 9/5[°F/°C] * T[°C] + 32[°F]
+            *p_temp = (float32_t)(( 1.8f * *p_temp ) + 32.0f );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get filtered temperature in kelvin
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[out]   p_temp  - Pointer to temperature
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_kelvin_filt(const th_ch_t th, float32_t * const p_temp)
+    {
+        const th_status_t status = th_ctx_get_degC_filt( &g_th_ctx, th, p_temp );
+
+        if ( eTH_OK == status )
+        {
+            // Conversion formula: T[K] = T[°C] + 273.15[K]
+            *p_temp = (float32_t)( *p_temp + 273.15f );
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get filtered temperature in milli deg C
+    *
+    * @note     With TH_FIXED_POINT_EN no floating point operation is used.
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[out]   p_temp  - Pointer to temperature
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_mdegC_filt(const th_ch_t th, int32_t * const p_temp)
+    {
+        return th_ctx_get_mdegC_filt( &g_th_ctx, th, p_temp );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Set LPF cuttoff frequency
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[in]    fc      - Cutoff frequency of LPF
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_set_lpf_fc(const th_ch_t th, const float32_t fc)
+    {
+        return th_ctx_set_lpf_fc( &g_th_ctx, th, fc );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Get LPF cuttoff frequency
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[out]   p_fc    - Pointer to LPF cutoff frequency
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_get_lpf_fc(const th_ch_t th, float32_t * const p_fc)
+    {
+        return th_ctx_get_lpf_fc( &g_th_ctx, th, p_fc );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Reset LPF filter
+    *
+    * @param[in]    th      - Thermistor option
+    * @param[in]    temp    - Temperature value to reset to
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    th_status_t th_reset_lpf(const th_ch_t th, const float32_t temp)
+    {
+        return th_ctx_reset_lpf( &g_th_ctx, th, temp );
+    }
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
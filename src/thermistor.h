@@ -7,8 +7,8 @@
 *@brief     Thermistor measurement and processing
 *@author    Ziga Miklosic
 *@email     ziga.miklosic@gmail.com
-*@date      01.02.2025
-*@version   V1.2.0
+*@date      16.10.2026
+*@version   V1.3.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -39,9 +39,29 @@
  *     Module version
  */
 #define TH_VER_MAJOR        ( 1 )
-#define TH_VER_MINOR        ( 2 )
+#define TH_VER_MINOR        ( 3 )
 #define TH_VER_DEVELOP      ( 0 )
 
+#if ( 1 == TH_LUT_EN )
+
+    /**
+     *  Number of points in look-up table of each thermistor
+     */
+    #define TH_LUT_SIZE         (( 1UL << TH_LUT_RES_BITS ) + 1UL )
+
+    /**
+     *  Look-up table point
+     *
+     *  Unit: milli degC with TH_FIXED_POINT_EN, otherwise degC
+     */
+    #if ( 1 == TH_FIXED_POINT_EN )
+        typedef int32_t th_lut_t;
+    #else
+        typedef float32_t th_lut_t;
+    #endif
+
+#endif
+
 /**
  *     Thermistor status
  */
@@ -51,30 +71,247 @@ typedef enum
     eTH_ERROR       = 0x01U,	/**<General error code */
     eTH_ERROR_OPEN  = 0x02U,	/**<Open connection on sensor terminal*/
     eTH_ERROR_SHORT = 0x04U,	/**<Shorted sensor connections */
+    eTH_ERROR_RATE  = 0x08U,	/**<Temperature changing faster than physically possible */
+    eTH_ERROR_STUCK = 0x10U,	/**<RAW ADC code frozen on the same value */
 } th_status_t;
 
+/**
+ *  Number of 32-bit words of fault mask of "n" thermistors
+ */
+#define TH_FAULT_MASK_WORDS_OF(n)   ((( n ) + 31UL ) / 32UL )
+
+/**
+ *  Number of 32-bit words of thermistor fault mask
+ */
+#define TH_FAULT_MASK_WORDS         ( TH_FAULT_MASK_WORDS_OF( eTH_NUM_OF ))
+
+/**
+ *  Thermistor temperature alarm
+ *
+ *  @note   Bitmask, more alarms can be active at once.
+ */
+typedef enum
+{
+    eTH_ALARM_NONE      = 0x00U,    /**<No active alarm */
+    eTH_ALARM_WARN_LOW  = 0x01U,    /**<Filtered temperature bellow warning low limit */
+    eTH_ALARM_WARN_HIGH = 0x02U,    /**<Filtered temperature above warning high limit */
+    eTH_ALARM_CRIT_LOW  = 0x04U,    /**<Filtered temperature bellow critical low limit */
+    eTH_ALARM_CRIT_HIGH = 0x08U,    /**<Filtered temperature above critical high limit */
+} th_alarm_t;
+
+#if ( 1 == TH_ALARM_EN )
+
+    /**
+     *  Number of 32-bit words of alarm mask of "n" thermistors
+     *
+     *  @note   Each thermistor takes 4 bits, alarms of thermistor "th"
+     *          are at bit "4 * ( th % 8 )" of word "th / 8".
+     */
+    #define TH_ALARM_MASK_WORDS_OF(n)   ((( n ) + 7UL ) / 8UL )
+
+    /**
+     *  Number of 32-bit words of thermistor alarm mask
+     */
+    #define TH_ALARM_MASK_WORDS         ( TH_ALARM_MASK_WORDS_OF( eTH_NUM_OF ))
+
+#endif
+
+/**
+ *  Thermistor sample
+ *
+ *  @note   Temperature unit is milli degC with TH_FIXED_POINT_EN, 
+ *          otherwise degC.
+ */
+typedef struct
+{
+    #if ( 1 == TH_FIXED_POINT_EN )
+        int32_t     temp;       /**<Temperature */
+        int32_t     temp_filt;  /**<Filtered temperature */
+    #else
+        float32_t   temp;       /**<Temperature */
+        float32_t   temp_filt;  /**<Filtered temperature */
+    #endif
+
+    float32_t   res;        /**<Thermistor resistance in Ohms */
+    uint16_t    raw;        /**<RAW ADC code, with TH_OVERSAMPLE_EN decimated code scaled by 2^(log2(oversample)/2) */
+    uint8_t     status;     /**<Thermistor status, th_status_t */
+
+    #if ( 1 == TH_ALARM_EN )
+        uint8_t alarm;      /**<Active alarms, th_alarm_t bitmask */
+    #endif
+} th_sample_t;
+
+/**
+ *  Thermistor context
+ *
+ *  @note   Opaque, storage is allocated by caller with size given by
+ *          th_ctx_get_size().
+ */
+typedef struct th_ctx_s th_ctx_t;
+
+#if ( 1 == TH_PERF_EN )
+
+    /**
+     *  Measured code section
+     */
+    typedef enum
+    {
+        eTH_PERF_HNDL = 0,          /**<Single handler call */
+        eTH_PERF_CONV_NTC,          /**<Conversion of NTC beta model */
+        eTH_PERF_CONV_NTC_SH,       /**<Conversion of NTC Steinhart-Hart model */
+        eTH_PERF_CONV_NTC_TAB,      /**<Conversion of NTC R-T table model */
+        eTH_PERF_CONV_PT,           /**<Conversion of PT100/500/1000 */
+        eTH_PERF_CONV_LUT,          /**<Conversion by look-up table */
+
+        eTH_PERF_NUM_OF
+    } th_perf_id_t;
+
+    /**
+     *  Number of execution time histogram bins
+     */
+    #define TH_PERF_HIST_SIZE       ( 32 )
+
+    /**
+     *  Execution time statistics
+     *
+     *  @note   Histogram bin "i" counts execution times in range
+     *          [2^i, 2^(i+1)), bin 0 includes also 0.
+     *
+     *  Unit: TH_GET_TIMESTAMP() ticks
+     */
+    typedef struct
+    {
+        uint32_t    cnt;                        /**<Number of measurements */
+        uint32_t    min;                        /**<Minimum execution time */
+        uint32_t    max;                        /**<Maximum execution time */
+        uint32_t    mean;                       /**<Mean execution time */
+        uint32_t    hist[TH_PERF_HIST_SIZE];    /**<Log2 histogram of execution time */
+    } th_perf_stats_t;
+
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+
+    /**
+     *  Thermistor event type
+     */
+    typedef enum
+    {
+        eTH_EVT_STATUS = 0,     /**<Thermistor status changed */
+        eTH_EVT_THR_ABOVE,      /**<Filtered temperature rose above threshold */
+        eTH_EVT_THR_BELOW,      /**<Filtered temperature fell below threshold minus hysteresis */
+        eTH_EVT_ALARM,          /**<Thermistor alarms changed, requires TH_ALARM_EN */
+    } th_evt_type_t;
+
+    /**
+     *  Thermistor event
+     *
+     *  @note   Temperature unit is milli degC with TH_FIXED_POINT_EN, 
+     *          otherwise degC.
+     */
+    typedef struct
+    {
+        #if ( 1 == TH_FIXED_POINT_EN )
+            int32_t     temp_filt;  /**<Filtered temperature */
+        #else
+            float32_t   temp_filt;  /**<Filtered temperature */
+        #endif
+
+        uint32_t        th;         /**<Thermistor index */
+        uint32_t        lost;       /**<Number of events dropped from queue before this one */
+        th_evt_type_t   type;       /**<Event type */
+        uint8_t         status;     /**<Thermistor status, th_status_t */
+        uint8_t         prev;       /**<Thermistor status before event, th_status_t */
+
+        #if ( 1 == TH_ALARM_EN )
+            uint8_t     alarm;      /**<Active alarms, th_alarm_t bitmask */
+            uint8_t     alarm_prev; /**<Active alarms before event, th_alarm_t bitmask */
+        #endif
+    } th_event_t;
+
+    /**
+     *  Thermistor event callback
+     *
+     *  @note   Called from handler context, only for event that was
+     *          queued. Dropped events are reported in "lost" of next one.
+     */
+    typedef void (*pf_th_event_cb_t)(const th_event_t * const p_event);
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == TH_LUT_IN_FLASH )
+    const th_lut_t * const * th_cfg_get_lut_table(void);
+#endif
+
 th_status_t th_init             (void);
 th_status_t th_deinit           (void);
 th_status_t th_is_init          (bool * const p_is_init);
 th_status_t th_hndl             (void);
+th_status_t th_hndl_raw         (const adc_ch_t ch_first, const uint16_t * const p_raw, const uint32_t size);
 
 th_status_t th_get_raw          (const th_ch_t th, uint16_t * const p_raw);
 th_status_t th_get_degC         (const th_ch_t th, float32_t * const p_temp);
 th_status_t th_get_degF         (const th_ch_t th, float32_t * const p_temp);
 th_status_t th_get_kelvin       (const th_ch_t th, float32_t * const p_temp);
+th_status_t th_get_mdegC        (const th_ch_t th, int32_t * const p_temp);
 th_status_t th_get_resistance   (const th_ch_t th, float32_t * const p_res);
 th_status_t th_get_status       (const th_ch_t th);
+th_status_t th_get_all          (th_sample_t * const p_samples, uint32_t * const p_fault);
+
+th_status_t th_ctx_get_size     (const th_cfg_t * const p_cfg, const uint32_t num_of, uint32_t * const p_size);
+th_status_t th_ctx_init         (th_ctx_t * const p_ctx, const th_cfg_t * const p_cfg, const uint32_t num_of);
+th_status_t th_ctx_deinit       (th_ctx_t * const p_ctx);
+th_status_t th_ctx_hndl         (th_ctx_t * const p_ctx);
+th_status_t th_ctx_hndl_raw     (th_ctx_t * const p_ctx, const adc_ch_t ch_first, const uint16_t * const p_raw, const uint32_t size);
+th_status_t th_ctx_get_sample   (th_ctx_t * const p_ctx, const uint32_t th, th_sample_t * const p_sample);
+th_status_t th_ctx_get_all      (th_ctx_t * const p_ctx, th_sample_t * const p_samples, uint32_t * const p_fault);
+
+th_status_t th_convert_raw_batch(const th_cfg_t * const p_cfg, const uint16_t * const p_raw, float32_t * const p_temp, const uint32_t size);
+
+#if ( 1 == TH_HNDL_BUDGET_EN )
+    th_status_t th_hndl_budget      (const uint32_t budget);
+    th_status_t th_get_hndl_lag     (uint32_t * const p_lag);
+    th_status_t th_ctx_hndl_budget  (th_ctx_t * const p_ctx, const uint32_t budget);
+    th_status_t th_ctx_get_hndl_lag (th_ctx_t * const p_ctx, uint32_t * const p_lag);
+#endif
+
+#if ( 1 == TH_PERF_EN )
+    th_status_t th_get_perf_stats       (const th_perf_id_t id, th_perf_stats_t * const p_stats);
+    th_status_t th_reset_perf_stats     (void);
+    th_status_t th_print_perf_stats     (void);
+    th_status_t th_ctx_get_perf_stats   (th_ctx_t * const p_ctx, const th_perf_id_t id, th_perf_stats_t * const p_stats);
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+    th_status_t th_get_event            (th_event_t * const p_event);
+    th_status_t th_set_event_cb         (const pf_th_event_cb_t pf_cb);
+    th_status_t th_ctx_get_event        (th_ctx_t * const p_ctx, th_event_t * const p_event);
+    th_status_t th_ctx_set_event_cb     (th_ctx_t * const p_ctx, const pf_th_event_cb_t pf_cb);
+#endif
+
+#if ( 1 == TH_ALARM_EN )
+    th_status_t th_get_alarm            (const th_ch_t th, uint8_t * const p_alarm);
+    th_status_t th_get_alarm_all        (uint32_t * const p_mask);
+    th_status_t th_ctx_get_alarm_all    (th_ctx_t * const p_ctx, uint32_t * const p_mask);
+#endif
 
 #if ( 1 == TH_FILTER_EN )
     th_status_t th_get_degC_filt    (const th_ch_t th, float32_t * const p_temp);
     th_status_t th_get_degF_filt    (const th_ch_t th, float32_t * const p_temp);
     th_status_t th_get_kelvin_filt  (const th_ch_t th, float32_t * const p_temp);
+    th_status_t th_get_mdegC_filt   (const th_ch_t th, int32_t * const p_temp);
     th_status_t th_set_lpf_fc       (const th_ch_t th, const float32_t fc);
     th_status_t th_get_lpf_fc       (const th_ch_t th, float32_t * const p_fc);
     th_status_t th_reset_lpf        (const th_ch_t th, const float32_t temp);
+
+    th_status_t th_ctx_get_degC_filt    (th_ctx_t * const p_ctx, const uint32_t th, float32_t * const p_temp);
+    th_status_t th_ctx_get_mdegC_filt   (th_ctx_t * const p_ctx, const uint32_t th, int32_t * const p_temp);
+    th_status_t th_ctx_set_lpf_fc       (th_ctx_t * const p_ctx, const uint32_t th, const float32_t fc);
+    th_status_t th_ctx_get_lpf_fc       (th_ctx_t * const p_ctx, const uint32_t th, float32_t * const p_fc);
+    th_status_t th_ctx_reset_lpf        (th_ctx_t * const p_ctx, const uint32_t th, const float32_t temp);
 #endif
 
 #endif // __THERMISTOR_H
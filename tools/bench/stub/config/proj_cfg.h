@@ -0,0 +1,22 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      proj_cfg.h
+*@brief     Stub of project configuration for host benchmarks
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJ_CFG_H
+#define __PROJ_CFG_H
+
+#include <assert.h>
+
+#define PROJ_CFG_ASSERT(x)      assert(x);
+
+#endif // __PROJ_CFG_H
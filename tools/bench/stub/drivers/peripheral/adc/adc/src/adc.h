@@ -0,0 +1,88 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      adc.h
+*@brief     Stub of ADC low level driver for host benchmarks
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*
+*@note      RAW ADC codes are taken from RAM, written by benchmark.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __ADC_H
+#define __ADC_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Floating point type
+ */
+typedef float float32_t;
+
+/**
+ *  ADC channels
+ *
+ *  @note   Names used by template configuration table, followed by
+ *          enough channels for largest benchmark.
+ */
+typedef enum
+{
+    eADC_CH_ELEVATOR_TEMP = 0,
+    eADC_CH_DELIVERY_TEMP,
+    eADC_CH_SLIDER_TEMP,
+    eADC_CH_AMBIENT_TEMP,
+
+    eADC_CH_NUM_OF = 256
+} adc_ch_t;
+
+/**
+ *  ADC status
+ */
+typedef enum
+{
+    eADC_OK     = 0x00U,
+    eADC_ERROR  = 0x01U,
+} adc_status_t;
+
+/**
+ *  ADC resolution
+ */
+#define ADC_RAW_MAX     ( 4095U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  RAW ADC codes of all channels, defined by benchmark
+ */
+extern uint16_t g_adc_raw[eADC_CH_NUM_OF];
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+static inline adc_status_t adc_get_raw(const adc_ch_t ch, uint16_t * const p_raw)
+{
+    *p_raw = g_adc_raw[ch];
+
+    return eADC_OK;
+}
+
+static inline uint16_t adc_get_raw_max(void)
+{
+    return ADC_RAW_MAX;
+}
+
+#endif // __ADC_H
@@ -0,0 +1,22 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      cli.h
+*@brief     Stub of command line interface for host benchmarks
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CLI_H
+#define __CLI_H
+
+#include <stdio.h>
+
+#define cli_printf(...)         printf( __VA_ARGS__ )
+
+#endif // __CLI_H
@@ -0,0 +1,418 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      th_accuracy.c
+*@brief     Host accuracy sweep of thermistor conversion
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*
+*@note      Each ADC code is converted by module and by double precision
+*           reference, with the same resistance clamps applied to both.
+*           Reference of NTC is beta equation, reference of PT sensors is
+*           full Callendar-Van Dusen equation. Maximum and RMS error over
+*           all ADC codes and over operating range of sensor are printed
+*           to stdout as CSV lines "sensor,variant,max_err_degC,
+*           rms_err_degC,max_err_op_degC,rms_err_op_degC,ns_per_sample".
+*
+*           Variant is given by active configuration: calculation with
+*           exact and batch (fast logarithm) conversion, or look-up table
+*           of TH_LUT_RES_BITS in floating or fixed point.
+*
+*           Build and run by "make accuracy" inside this directory.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "thermistor/src/thermistor.c"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Number of ADC codes of sweep
+ */
+#define TH_ACC_SWEEP_SIZE           ( ADC_RAW_MAX + 1U )
+
+/**
+ *  Number of sweep repetitions for timing, best one is reported
+ */
+#define TH_ACC_SWEEP_REP            ( 50U )
+
+/**
+ *  Number of sensors under test
+ */
+#define TH_ACC_NUM_OF               ( 4U )
+
+/**
+ *  Callendar-Van Dusen coefficients of reference, DIN EN60751
+ */
+#define TH_ACC_CVD_A                ( 3.9083e-3 )
+#define TH_ACC_CVD_B                ( -5.775e-7 )
+#define TH_ACC_CVD_C                ( -4.183e-12 )
+
+/**
+ *  Variant name of active configuration
+ */
+#if ( 1 == TH_LUT_EN )
+    #if ( 1 == TH_FIXED_POINT_EN )
+        #define TH_ACC_VARIANT      "lut_fixed_"
+    #else
+        #define TH_ACC_VARIANT      "lut_f32_"
+    #endif
+#else
+    #define TH_ACC_VARIANT          "exact_f32"
+#endif
+
+/**
+ *  Sensor under test
+ */
+typedef struct
+{
+    const char *    p_name;     /**<Sensor name */
+    th_temp_type_t  type;       /**<Sensor type */
+    double          nom;        /**<Nominal resistance, also pull-down resistance */
+    double          op_min;     /**<Minimum of operating range in degC */
+    double          op_max;     /**<Maximum of operating range in degC */
+} th_acc_sensor_t;
+
+/**
+ *  Error statistics
+ */
+typedef struct
+{
+    double  max;        /**<Maximum absolute error over all ADC codes */
+    double  sum_sq;     /**<Sum of squared error over all ADC codes */
+    double  max_op;     /**<Maximum absolute error in operating range */
+    double  sum_sq_op;  /**<Sum of squared error in operating range */
+    uint32_t cnt;       /**<Number of ADC codes */
+    uint32_t cnt_op;    /**<Number of ADC codes in operating range */
+} th_acc_err_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  RAW ADC codes of stub ADC driver
+ */
+uint16_t g_adc_raw[eADC_CH_NUM_OF] = {0};
+
+/**
+ *  Sensors under test
+ */
+static const th_acc_sensor_t g_th_acc_sensor[TH_ACC_NUM_OF] =
+{
+    { .p_name = "ntc_10k_b3435", .type = eTH_TYPE_NTC,    .nom = 10e3,   .op_min = -40.0,  .op_max = 125.0 },
+    { .p_name = "pt100",         .type = eTH_TYPE_PT100,  .nom = 100.0,  .op_min = -200.0, .op_max = 850.0 },
+    { .p_name = "pt500",         .type = eTH_TYPE_PT500,  .nom = 500.0,  .op_min = -200.0, .op_max = 850.0 },
+    { .p_name = "pt1000",        .type = eTH_TYPE_PT1000, .nom = 1000.0, .op_min = -200.0, .op_max = 850.0 },
+};
+
+/**
+ *  Sink of timed conversions, so that compiler keeps timed work
+ */
+static volatile float32_t g_th_acc_sink = 0.0f;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Get monotonic time
+*
+* @return       time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double th_acc_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (((double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Fill thermistor configuration of sensor under test
+*
+* @note     Thermistor on high side with pull-down equal to nominal
+*           resistance. Range is wider than any sensor, so that it does
+*           not limit conversion.
+*
+* @param[out]   p_cfg       - Thermistor configuration
+* @param[in]    p_sensor    - Sensor under test
+* @param[in]    ch          - ADC channel
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_acc_cfg(th_cfg_t * const p_cfg, const th_acc_sensor_t * const p_sensor, const adc_ch_t ch)
+{
+    memset( p_cfg, 0, sizeof( th_cfg_t ));
+
+    p_cfg->adc_ch       = ch;
+    p_cfg->type         = p_sensor->type;
+    p_cfg->hw.conn      = eTH_HW_HIGH_SIDE;
+    p_cfg->hw.pull_mode = eTH_HW_PULL_DOWN;
+    p_cfg->hw.pull_up   = (float32_t) p_sensor->nom;
+    p_cfg->hw.pull_down = (float32_t) p_sensor->nom;
+    p_cfg->ntc.beta     = 3435.0f;
+    p_cfg->ntc.nom_val  = 10e3f;
+    p_cfg->range.min    = -300.0f;
+    p_cfg->range.max    = 2000.0f;
+    p_cfg->lpf_fc       = 1.0f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Reference temperature in double precision
+*
+* @note     Resistance mirrors high side calculation of module, including
+*           +1 LSB offset and resistance clamps. PT temperature bellow
+*           0 degC is solved by Newton iteration of full Callendar-Van
+*           Dusen equation.
+*
+* @param[in]    p_sensor    - Sensor under test
+* @param[in]    p_coef      - Thermistor coefficients of module
+* @param[in]    raw         - RAW ADC code
+* @return       temp        - Temperature in degC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double th_acc_ref(const th_acc_sensor_t * const p_sensor, const th_coef_t * const p_coef, const uint16_t raw)
+{
+    const double    adc     = ( (double) raw + (double) p_coef->raw_lsb );
+    const double    max     = (double) p_coef->raw_max;
+    double          res     = ( adc < max ) ? (( p_sensor->nom * ( max - adc )) / adc ) : 0.0;
+    double          temp    = 0.0;
+
+    res = fmax( res, (double) p_coef->res_min );
+    res = fmin( res, (double) p_coef->res_max );
+
+    if ( eTH_TYPE_NTC == p_sensor->type )
+    {
+        temp = (( 1.0 / (( 1.0 / 298.15 ) + ( log( res / 10e3 ) / 3435.0 ))) - 273.15 );
+    }
+    else
+    {
+        const double a = TH_ACC_CVD_A;
+        const double b = TH_ACC_CVD_B;
+        const double c = TH_ACC_CVD_C;
+        const double q = ( res / p_sensor->nom );
+
+        temp = (( -a + sqrt(( a * a ) - ( 4.0 * b * ( 1.0 - q )))) / ( 2.0 * b ));
+
+        if ( q < 1.0 )
+        {
+            for ( uint32_t i = 0; i < 50U; i++ )
+            {
+                const double f  = ( 1.0 + ( a * temp ) + ( b * temp * temp ) + ( c * ( temp - 100.0 ) * temp * temp * temp ) - q );
+                const double df = ( a + ( 2.0 * b * temp ) + ( c * (( 4.0 * temp * temp * temp ) - ( 300.0 * temp * temp ))));
+
+                temp -= ( f / df );
+            }
+        }
+    }
+
+    return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Add error of single ADC code to statistics
+*
+* @param[in,out]    p_err       - Error statistics
+* @param[in]        p_sensor    - Sensor under test
+* @param[in]        temp        - Temperature of module in degC
+* @param[in]        ref         - Reference temperature in degC
+* @return           void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_acc_err_add(th_acc_err_t * const p_err, const th_acc_sensor_t * const p_sensor, const double temp, const double ref)
+{
+    const double err = fabs( temp - ref );
+
+    p_err->max      = fmax( p_err->max, err );
+    p_err->sum_sq   += ( err * err );
+    p_err->cnt++;
+
+    if (( ref >= p_sensor->op_min ) && ( ref <= p_sensor->op_max ))
+    {
+        p_err->max_op       = fmax( p_err->max_op, err );
+        p_err->sum_sq_op    += ( err * err );
+        p_err->cnt_op++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Print error statistics as CSV line
+*
+* @param[in]    p_sensor    - Sensor under test
+* @param[in]    p_variant   - Variant name
+* @param[in]    p_err       - Error statistics
+* @param[in]    ns          - Conversion time per sample in ns
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_acc_print(const th_acc_sensor_t * const p_sensor, const char * const p_variant, const th_acc_err_t * const p_err, const double ns)
+{
+    printf( "%s,%s,%.4f,%.4f,%.4f,%.4f,%.2f\n", p_sensor->p_name, p_variant,
+            p_err->max, sqrt( p_err->sum_sq / p_err->cnt ),
+            p_err->max_op, sqrt( p_err->sum_sq_op / p_err->cnt_op ), ns );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Sweep all ADC codes through per sample conversion of handler
+*
+* @param[in]    p_ctx       - Thermistor context
+* @param[in]    th          - Thermistor index of sensor under test
+* @param[in]    p_variant   - Variant name
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_acc_sweep(th_ctx_t * const p_ctx, const uint32_t th, const char * const p_variant)
+{
+    const th_acc_sensor_t * const   p_sensor    = &g_th_acc_sensor[th];
+    th_acc_err_t                    err         = {0};
+    double                          best        = 1e30;
+
+    for ( uint32_t raw = 0; raw < TH_ACC_SWEEP_SIZE; raw++ )
+    {
+        const double temp = TH_TEMP_TO_DEGC( th_conv_raw_to_temperature( p_ctx, th, (uint16_t) raw ));
+
+        th_acc_err_add( &err, p_sensor, temp, th_acc_ref( p_sensor, &p_ctx->p_coef[th], (uint16_t) raw ));
+    }
+
+    for ( uint32_t rep = 0; rep < TH_ACC_SWEEP_REP; rep++ )
+    {
+        const double    start   = th_acc_now();
+        th_temp_t       acc     = 0;
+
+        for ( uint32_t raw = 0; raw < TH_ACC_SWEEP_SIZE; raw++ )
+        {
+            acc += th_conv_raw_to_temperature( p_ctx, th, (uint16_t) raw );
+        }
+
+        g_th_acc_sink = (float32_t) acc;
+
+        best = fmin( best, ( th_acc_now() - start ));
+    }
+
+    th_acc_print( p_sensor, p_variant, &err, ( best / TH_ACC_SWEEP_SIZE ));
+}
+
+#if ( 0 == TH_LUT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Sweep all ADC codes through batch conversion
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    th      - Thermistor index of sensor under test
+    * @param[in]    p_cfg   - Thermistor configuration
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_acc_sweep_batch(th_ctx_t * const p_ctx, const uint32_t th, const th_cfg_t * const p_cfg)
+    {
+        static uint16_t                 raw[TH_ACC_SWEEP_SIZE];
+        static float32_t                temp[TH_ACC_SWEEP_SIZE];
+        const th_acc_sensor_t * const   p_sensor    = &g_th_acc_sensor[th];
+        th_acc_err_t                    err         = {0};
+        double                          best        = 1e30;
+
+        for ( uint32_t i = 0; i < TH_ACC_SWEEP_SIZE; i++ )
+        {
+            raw[i] = (uint16_t) i;
+        }
+
+        th_convert_raw_batch( p_cfg, raw, temp, TH_ACC_SWEEP_SIZE );
+
+        for ( uint32_t i = 0; i < TH_ACC_SWEEP_SIZE; i++ )
+        {
+            th_acc_err_add( &err, p_sensor, temp[i], th_acc_ref( p_sensor, &p_ctx->p_coef[th], raw[i] ));
+        }
+
+        for ( uint32_t rep = 0; rep < TH_ACC_SWEEP_REP; rep++ )
+        {
+            const double start = th_acc_now();
+
+            th_convert_raw_batch( p_cfg, raw, temp, TH_ACC_SWEEP_SIZE );
+            g_th_acc_sink = temp[ TH_ACC_SWEEP_SIZE / 2U ];
+
+            best = fmin( best, ( th_acc_now() - start ));
+        }
+
+        th_acc_print( p_sensor, "batch_fast_log", &err, ( best / TH_ACC_SWEEP_SIZE ));
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Run accuracy sweep of all sensors for active configuration
+*
+* @return       status - 0 on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    static th_cfg_t cfg[TH_ACC_NUM_OF];
+    th_status_t     status  = eTH_OK;
+    th_ctx_t *      p_ctx   = NULL;
+    uint32_t        size    = 0U;
+    char            variant[32];
+
+    #if ( 1 == TH_LUT_EN )
+        snprintf( variant, sizeof( variant ), "%s%ubit", TH_ACC_VARIANT, (unsigned) TH_LUT_RES_BITS );
+    #else
+        snprintf( variant, sizeof( variant ), "%s", TH_ACC_VARIANT );
+    #endif
+
+    for ( uint32_t th = 0; th < TH_ACC_NUM_OF; th++ )
+    {
+        th_acc_cfg( &cfg[th], &g_th_acc_sensor[th], (adc_ch_t) th );
+    }
+
+    status = th_ctx_get_size( cfg, TH_ACC_NUM_OF, &size );
+
+    if ( eTH_OK == status )
+    {
+        p_ctx   = malloc( size );
+        status  = ( NULL != p_ctx ) ? th_ctx_init( p_ctx, cfg, TH_ACC_NUM_OF ) : eTH_ERROR;
+    }
+
+    if ( eTH_OK == status )
+    {
+        for ( uint32_t th = 0; th < TH_ACC_NUM_OF; th++ )
+        {
+            th_acc_sweep( p_ctx, th, variant );
+        }
+
+        #if ( 0 == TH_LUT_EN )
+            for ( uint32_t th = 0; th < TH_ACC_NUM_OF; th++ )
+            {
+                th_acc_sweep_batch( p_ctx, th, &cfg[th] );
+            }
+        #endif
+
+        status = th_ctx_deinit( p_ctx );
+    }
+
+    free( p_ctx );
+
+    return ( eTH_OK == status ) ? 0 : 1;
+}
@@ -0,0 +1,414 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      th_bench.c
+*@brief     Host benchmark of thermistor module
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*
+*@note      Module source is included, so that static conversion kernels
+*           can be timed directly. Results are printed to stdout as CSV
+*           lines "benchmark,unit,ns,rate_per_s". Benchmark names are
+*           prefixed by active configuration (LUT, fixed point, no
+*           filter), conversion kernels are timed only with calculation
+*           pipeline.
+*
+*           With TH_PERF_EN handler benchmark also reports mean and
+*           maximum handler execution time collected by module own 
+*           instrumentation, timestamped by host monotonic clock.
+*
+*           Build and run by "make perf" or "make instr" inside this 
+*           directory.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "thermistor/src/thermistor.c"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Number of samples of kernel sweep
+ */
+#define TH_BENCH_SWEEP_SIZE         ( 4096U )
+
+/**
+ *  Number of kernel sweep repetitions, best one is reported
+ */
+#define TH_BENCH_SWEEP_REP          ( 200U )
+
+/**
+ *  Number of handler calls per measurement and number of measurements,
+ *  best one is reported
+ */
+#define TH_BENCH_HNDL_CALLS         ( 100U )
+#define TH_BENCH_HNDL_REP           ( 200U )
+
+/**
+ *  Maximum span of resistance sweep of temperature kernels in Ohms
+ */
+#define TH_BENCH_RES_SPAN_MAX       ( 1e5f )
+
+/**
+ *  Benchmark name prefix of active configuration
+ */
+#if ( 1 == TH_LUT_EN )
+    #define TH_BENCH_PREFIX_LUT     "lut_"
+#else
+    #define TH_BENCH_PREFIX_LUT     ""
+#endif
+
+#if ( 1 == TH_FIXED_POINT_EN )
+    #define TH_BENCH_PREFIX_FIXED   "fixed_"
+#else
+    #define TH_BENCH_PREFIX_FIXED   ""
+#endif
+
+#if ( 1 == TH_FILTER_EN )
+    #define TH_BENCH_PREFIX_FILT    ""
+#else
+    #define TH_BENCH_PREFIX_FILT    "nofilt_"
+#endif
+
+#if ( 1 == TH_PERF_EN )
+    #define TH_BENCH_PREFIX_PERF    "perf_"
+#else
+    #define TH_BENCH_PREFIX_PERF    ""
+#endif
+
+#define TH_BENCH_PREFIX             TH_BENCH_PREFIX_LUT TH_BENCH_PREFIX_FIXED TH_BENCH_PREFIX_FILT TH_BENCH_PREFIX_PERF
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  RAW ADC codes of stub ADC driver
+ */
+uint16_t g_adc_raw[eADC_CH_NUM_OF] = {0};
+
+/**
+ *  Sink of benchmark results, so that compiler keeps timed work
+ */
+static volatile float32_t g_th_bench_sink = 0.0f;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Get monotonic time
+*
+* @return       time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double th_bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (((double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Print single benchmark result as CSV line
+*
+* @param[in]    p_name  - Benchmark name
+* @param[in]    p_unit  - Unit of work, "sample" or "call"
+* @param[in]    ns      - Time of single unit of work in ns
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_bench_print(const char * const p_name, const char * const p_unit, const double ns)
+{
+    printf( "%s,%s,%.2f,%.0f\n", p_name, p_unit, ns, ( 1e9 / ns ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Fill thermistor configuration of benchmark
+*
+* @note     Pull resistor is equal to nominal resistance of sensor.
+*
+* @param[out]   p_cfg   - Thermistor configuration
+* @param[in]    type    - Sensor type
+* @param[in]    conn    - Thermistor connection
+* @param[in]    ch      - ADC channel
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_bench_cfg(th_cfg_t * const p_cfg, const th_temp_type_t type, const th_hw_conn_t conn, const adc_ch_t ch)
+{
+    float32_t nom = 10e3f;
+
+    switch( type )
+    {
+        case eTH_TYPE_PT100:    nom = 100.0f;   break;
+        case eTH_TYPE_PT500:    nom = 500.0f;   break;
+        case eTH_TYPE_PT1000:   nom = 1000.0f;  break;
+        default:                                break;
+    }
+
+    memset( p_cfg, 0, sizeof( th_cfg_t ));
+
+    p_cfg->adc_ch       = ch;
+    p_cfg->type         = type;
+    p_cfg->hw.conn      = conn;
+    p_cfg->hw.pull_mode = ( eTH_HW_LOW_SIDE == conn ) ? eTH_HW_PULL_UP : eTH_HW_PULL_DOWN;
+    p_cfg->hw.pull_up   = nom;
+    p_cfg->hw.pull_down = nom;
+    p_cfg->ntc.beta     = 3435.0f;
+    p_cfg->ntc.nom_val  = 10e3f;
+    p_cfg->range.min    = -50.0f;
+    p_cfg->range.max    = 150.0f;
+    p_cfg->lpf_fc       = 1.0f;
+}
+
+#if ( 0 == TH_LUT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Benchmark temperature kernel over resistance sweep
+    *
+    * @param[in]    p_name  - Benchmark name
+    * @param[in]    type    - Sensor type
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_bench_kernel(const char * const p_name, const th_temp_type_t type)
+    {
+        static float32_t    res[TH_BENCH_SWEEP_SIZE];
+        th_cfg_t            cfg;
+        th_coef_t           coef;
+        double              best = 1e30;
+
+        th_bench_cfg( &cfg, type, eTH_HW_HIGH_SIDE, 0 );
+        th_init_coef( &cfg, &coef );
+
+        const float32_t span = fminf(( coef.res_max - coef.res_min ), TH_BENCH_RES_SPAN_MAX );
+
+        for ( uint32_t i = 0; i < TH_BENCH_SWEEP_SIZE; i++ )
+        {
+            res[i] = coef.res_min + (( span * (float32_t) i ) / (float32_t) TH_BENCH_SWEEP_SIZE );
+        }
+
+        // Call through volatile pointer, as handler does
+        pf_th_calc_temp_t volatile pf_calc = coef.pf_calc_temp;
+
+        for ( uint32_t rep = 0; rep < TH_BENCH_SWEEP_REP; rep++ )
+        {
+            const double    start   = th_bench_now();
+            float32_t       acc     = 0.0f;
+
+            for ( uint32_t i = 0; i < TH_BENCH_SWEEP_SIZE; i++ )
+            {
+                acc += pf_calc( &coef, res[i] );
+            }
+
+            g_th_bench_sink = acc;
+
+            best = fmin( best, ( th_bench_now() - start ));
+        }
+
+        th_bench_print( p_name, "sample", ( best / TH_BENCH_SWEEP_SIZE ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Benchmark resistance kernel over all ADC codes
+    *
+    * @param[in]    p_name  - Benchmark name
+    * @param[in]    conn    - Thermistor connection
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_bench_res(const char * const p_name, const th_hw_conn_t conn)
+    {
+        th_cfg_t    cfg;
+        th_coef_t   coef;
+        double      best = 1e30;
+
+        th_bench_cfg( &cfg, eTH_TYPE_NTC, conn, 0 );
+        th_init_coef( &cfg, &coef );
+
+        pf_th_calc_res_t volatile pf_calc = coef.pf_calc_res;
+
+        for ( uint32_t rep = 0; rep < TH_BENCH_SWEEP_REP; rep++ )
+        {
+            const double    start   = th_bench_now();
+            float32_t       acc     = 0.0f;
+
+            for ( uint32_t i = 0; i < TH_BENCH_SWEEP_SIZE; i++ )
+            {
+                acc += pf_calc( &coef, (uint16_t) i );
+            }
+
+            g_th_bench_sink = acc;
+
+            best = fmin( best, ( th_bench_now() - start ));
+        }
+
+        th_bench_print( p_name, "sample", ( best / TH_BENCH_SWEEP_SIZE ));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Benchmark batch conversion over all ADC codes
+    *
+    * @param[in]    p_name  - Benchmark name
+    * @param[in]    type    - Sensor type
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void th_bench_batch(const char * const p_name, const th_temp_type_t type)
+    {
+        static uint16_t     raw[TH_BENCH_SWEEP_SIZE];
+        static float32_t    temp[TH_BENCH_SWEEP_SIZE];
+        th_cfg_t            cfg;
+        double              best = 1e30;
+
+        th_bench_cfg( &cfg, type, eTH_HW_HIGH_SIDE, 0 );
+
+        for ( uint32_t i = 0; i < TH_BENCH_SWEEP_SIZE; i++ )
+        {
+            raw[i] = (uint16_t) i;
+        }
+
+        for ( uint32_t rep = 0; rep < TH_BENCH_SWEEP_REP; rep++ )
+        {
+            const double start = th_bench_now();
+
+            th_convert_raw_batch( &cfg, raw, temp, TH_BENCH_SWEEP_SIZE );
+            g_th_bench_sink = temp[ TH_BENCH_SWEEP_SIZE / 2U ];
+
+            best = fmin( best, ( th_bench_now() - start ));
+        }
+
+        th_bench_print( p_name, "sample", ( best / TH_BENCH_SWEEP_SIZE ));
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Benchmark handler of context with given number of thermistors
+*
+* @note     Each thermistor has its own ADC channel with different code,
+*           all are processed on each handler call.
+*
+* @param[in]    p_name  - Sensor name
+* @param[in]    type    - Sensor type
+* @param[in]    num_of  - Number of thermistors
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_status_t th_bench_hndl(const char * const p_name, const th_temp_type_t type, const uint32_t num_of)
+{
+    static th_cfg_t cfg[eADC_CH_NUM_OF];
+    th_status_t     status  = eTH_OK;
+    th_ctx_t *      p_ctx   = NULL;
+    uint32_t        size    = 0U;
+    double          best    = 1e30;
+    char            name[64];
+
+    for ( uint32_t th = 0; th < num_of; th++ )
+    {
+        th_bench_cfg( &cfg[th], type, eTH_HW_HIGH_SIDE, (adc_ch_t) th );
+        g_adc_raw[th] = (uint16_t)( 1500U + (( th * 37U ) % 1000U ));
+    }
+
+    status |= th_ctx_get_size( cfg, num_of, &size );
+
+    if ( eTH_OK == status )
+    {
+        p_ctx   = malloc( size );
+        status  = ( NULL != p_ctx ) ? th_ctx_init( p_ctx, cfg, num_of ) : eTH_ERROR;
+    }
+
+    if ( eTH_OK == status )
+    {
+        for ( uint32_t rep = 0; rep < TH_BENCH_HNDL_REP; rep++ )
+        {
+            const double start = th_bench_now();
+
+            for ( uint32_t i = 0; i < TH_BENCH_HNDL_CALLS; i++ )
+            {
+                status |= th_ctx_hndl( p_ctx );
+            }
+
+            best = fmin( best, ( th_bench_now() - start ));
+        }
+
+        snprintf( name, sizeof( name ), "hndl_%s%s_%uch", TH_BENCH_PREFIX, p_name, (unsigned) num_of );
+        th_bench_print( name, "call", ( best / TH_BENCH_HNDL_CALLS ));
+
+        #if ( 1 == TH_PERF_EN )
+        {
+            th_perf_stats_t stats = {0};
+
+            status |= th_ctx_get_perf_stats( p_ctx, eTH_PERF_HNDL, &stats );
+
+            snprintf( name, sizeof( name ), "hndl_%s%s_%uch_instr_mean", TH_BENCH_PREFIX, p_name, (unsigned) num_of );
+            th_bench_print( name, "call", (double) stats.mean );
+
+            snprintf( name, sizeof( name ), "hndl_%s%s_%uch_instr_max", TH_BENCH_PREFIX, p_name, (unsigned) num_of );
+            th_bench_print( name, "call", (double) stats.max );
+        }
+        #endif
+
+        status |= th_ctx_deinit( p_ctx );
+    }
+
+    free( p_ctx );
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Run all benchmarks of active configuration
+*
+* @return       status - 0 on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    static const uint32_t   num_of[] = { 4U, 32U, 256U };
+    th_status_t             status   = eTH_OK;
+
+    #if ( 0 == TH_LUT_EN )
+        th_bench_kernel( "kernel_ntc",    eTH_TYPE_NTC );
+        th_bench_kernel( "kernel_pt100",  eTH_TYPE_PT100 );
+        th_bench_kernel( "kernel_pt500",  eTH_TYPE_PT500 );
+        th_bench_kernel( "kernel_pt1000", eTH_TYPE_PT1000 );
+
+        th_bench_res( "res_low_side_pull_up",    eTH_HW_LOW_SIDE );
+        th_bench_res( "res_high_side_pull_down", eTH_HW_HIGH_SIDE );
+
+        th_bench_batch( "batch_ntc",   eTH_TYPE_NTC );
+        th_bench_batch( "batch_pt100", eTH_TYPE_PT100 );
+    #endif
+
+    for ( uint32_t i = 0; i < ( sizeof( num_of ) / sizeof( num_of[0] )); i++ )
+    {
+        status |= th_bench_hndl( "ntc",   eTH_TYPE_NTC,   num_of[i] );
+        status |= th_bench_hndl( "pt100", eTH_TYPE_PT100, num_of[i] );
+    }
+
+    return ( eTH_OK == status ) ? 0 : 1;
+}
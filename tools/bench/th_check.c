@@ -0,0 +1,524 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      th_check.c
+*@brief     Host behaviour check of thermistor module
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      16.10.2026
+*@version   V1.3.0
+*
+*@note      Drives context handler with RAW ADC codes of stub ADC driver
+*           and checks status debounce, sensor diagnostics and events
+*           sample by sample. Checks of disabled features are skipped.
+*           Results are printed to stdout as lines "check,result",
+*           exit code is 0 only when all checks pass.
+*
+*           Thermistors are configured as entries of template
+*           configuration table (NTC 10k B3435 on high side with 4k7
+*           pull-down), so that flash look-up tables of template are
+*           valid for them.
+*
+*           Build and run by "make check" inside this directory.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+
+#include "thermistor/src/thermistor.c"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Number of thermistors of checked context
+ *
+ *  @note   Must not exceed entries of template configuration table,
+ *          as flash look-up tables are taken from it.
+ */
+#define TH_CHK_NUM_OF               ( 4U )
+
+/**
+ *  Thermistor used by each check
+ */
+#define TH_CHK_TH                   ( 1U )
+
+/**
+ *  Maximum handler calls to wait for expected change
+ */
+#define TH_CHK_CALLS_MAX            ( 1000U )
+
+/**
+ *  Status debounce of checks, in samples
+ */
+#define TH_CHK_DEBOUNCE             ( 3U )
+
+/**
+ *  Stuck sensor detection of check, in samples
+ */
+#define TH_CHK_STUCK                ( 20U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  RAW ADC codes of stub ADC driver
+ */
+uint16_t g_adc_raw[eADC_CH_NUM_OF] = {0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Print single check result
+*
+* @param[in]    p_name  - Check name
+* @param[in]    is_pass - Check passed
+* @return       status  - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_status_t th_chk_print(const char * const p_name, const bool is_pass)
+{
+    printf( "%s,%s\n", p_name, ( true == is_pass ) ? "pass" : "FAIL" );
+
+    return ( true == is_pass ) ? eTH_OK : eTH_ERROR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Get RAW ADC code of NTC at temperature
+*
+* @param[in]    temp    - Temperature in degC
+* @return       raw     - RAW ADC code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t th_chk_raw(const double temp)
+{
+    const double res = ( 10e3 * exp( 3435.0 * (( 1.0 / ( temp + 273.15 )) - ( 1.0 / 298.15 ))));
+
+    return (uint16_t) lround(( ADC_RAW_MAX * 4.7e3 ) / ( res + 4.7e3 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Fill thermistor configuration of checks
+*
+* @param[out]   p_cfg   - Thermistor configuration
+* @param[in]    ch      - ADC channel
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void th_chk_cfg(th_cfg_t * const p_cfg, const adc_ch_t ch)
+{
+    memset( p_cfg, 0, sizeof( th_cfg_t ));
+
+    p_cfg->adc_ch       = ch;
+    p_cfg->type         = eTH_TYPE_NTC;
+    p_cfg->hw.conn      = eTH_HW_HIGH_SIDE;
+    p_cfg->hw.pull_mode = eTH_HW_PULL_DOWN;
+    p_cfg->hw.pull_down = 4.7e3f;
+    p_cfg->ntc.beta     = 3435.0f;
+    p_cfg->ntc.nom_val  = 10e3f;
+    p_cfg->range.min    = -25.0f;
+    p_cfg->range.max    = 100.0f;
+    p_cfg->lpf_fc       = 1.0f;
+    p_cfg->err_type     = eTH_ERR_FLOATING;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Init context of checks
+*
+* @note     All thermistors start at 25 degC and filters are settled
+*           there. Context storage shall be freed by caller.
+*
+* @param[in]    p_cfg   - Configuration table of TH_CHK_NUM_OF entries
+* @return       p_ctx   - Thermistor context, NULL on failure
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_ctx_t * th_chk_init(const th_cfg_t * const p_cfg)
+{
+    th_ctx_t *  p_ctx   = NULL;
+    uint32_t    size    = 0U;
+
+    for ( uint32_t th = 0; th < TH_CHK_NUM_OF; th++ )
+    {
+        g_adc_raw[th] = th_chk_raw( 25.0 );
+    }
+
+    if ( eTH_OK == th_ctx_get_size( p_cfg, TH_CHK_NUM_OF, &size ))
+    {
+        p_ctx = malloc( size );
+
+        if  (   ( NULL != p_ctx )
+            &&  ( eTH_OK != th_ctx_init( p_ctx, p_cfg, TH_CHK_NUM_OF )))
+        {
+            free( p_ctx );
+            p_ctx = NULL;
+        }
+    }
+
+    return p_ctx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Call handler once and get sample of checked thermistor
+*
+* @param[in]    p_ctx   - Thermistor context
+* @return       sample  - Sample of checked thermistor after handler call
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_sample_t th_chk_step(th_ctx_t * const p_ctx)
+{
+    th_sample_t sample = {0};
+
+    (void) th_ctx_hndl( p_ctx );
+    (void) th_ctx_get_sample( p_ctx, TH_CHK_TH, &sample );
+
+    return sample;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Get filtered temperature of sample in degC
+*
+* @param[in]    p_sample    - Thermistor sample
+* @return       temp        - Filtered temperature in degC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t th_chk_temp_filt(const th_sample_t * const p_sample)
+{
+    #if ( 1 == TH_FIXED_POINT_EN )
+        return ((float32_t) p_sample->temp_filt / 1000.0f );
+    #else
+        return p_sample->temp_filt;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Check debounce of range status
+*
+* @note     Temperature alternating bellow minimum and above maximum
+*           on every sample shall not confirm any status. After 
+*           temperature step over maximum, status shall change on
+*           exactly "debounce" sample with filtered temperature out of
+*           range, counting the first one.
+*
+* @return       status  - Status of check
+*/
+////////////////////////////////////////////////////////////////////////////////
+static th_status_t th_chk_range_debounce(void)
+{
+    th_cfg_t    cfg[TH_CHK_NUM_OF];
+    th_ctx_t *  p_ctx   = NULL;
+    uint32_t    out     = 0U;
+    bool        is_pass = false;
+
+    for ( uint32_t th = 0; th < TH_CHK_NUM_OF; th++ )
+    {
+        th_chk_cfg( &cfg[th], (adc_ch_t) th );
+    }
+
+    // Filter follows step within one sample
+    cfg[TH_CHK_TH].range.debounce   = TH_CHK_DEBOUNCE;
+    cfg[TH_CHK_TH].lpf_fc           = 40.0f;
+
+    p_ctx = th_chk_init( cfg );
+
+    if ( NULL != p_ctx )
+    {
+        bool is_ok = true;
+
+        // Open and short alternating on every sample
+        for ( uint32_t i = 0; i < ( 4U * TH_CHK_DEBOUNCE ); i++ )
+        {
+            g_adc_raw[TH_CHK_TH] = th_chk_raw(( 0U == ( i & 1U )) ? 150.0 : -50.0 );
+
+            is_ok &= ( eTH_OK == th_chk_step( p_ctx ).status );
+        }
+
+        // Settle back in range
+        g_adc_raw[TH_CHK_TH] = th_chk_raw( 25.0 );
+
+        for ( uint32_t i = 0; i < TH_CHK_DEBOUNCE; i++ )
+        {
+            is_ok &= ( eTH_OK == th_chk_step( p_ctx ).status );
+        }
+
+        g_adc_raw[TH_CHK_TH] = th_chk_raw( 120.0 );
+
+        for ( uint32_t i = 0; i < TH_CHK_CALLS_MAX; i++ )
+        {
+            const th_sample_t sample = th_chk_step( p_ctx );
+
+            // Samples with filtered temperature out of range
+            out += ( th_chk_temp_filt( &sample ) > cfg[TH_CHK_TH].range.max ) ? 1U : 0U;
+
+            if ( eTH_OK != sample.status )
+            {
+                is_pass = (( true == is_ok ) && ( eTH_ERROR_SHORT == sample.status ) && ( TH_CHK_DEBOUNCE == out ));
+                break;
+            }
+        }
+
+        (void) th_ctx_deinit( p_ctx );
+    }
+
+    free( p_ctx );
+
+    return th_chk_print( "range_debounce", is_pass );
+}
+
+#if ( 1 == TH_DIAG_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Check stuck sensor detection
+    *
+    * @note     With noisy code status shall stay OK, after code freezes
+    *           stuck status shall be set on exactly "stuck" unchanged
+    *           sample.
+    *
+    * @return       status  - Status of check
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_status_t th_chk_diag_stuck(void)
+    {
+        th_cfg_t        cfg[TH_CHK_NUM_OF];
+        th_ctx_t *      p_ctx   = NULL;
+        const uint16_t  raw     = th_chk_raw( 25.0 );
+        bool            is_pass = false;
+
+        for ( uint32_t th = 0; th < TH_CHK_NUM_OF; th++ )
+        {
+            th_chk_cfg( &cfg[th], (adc_ch_t) th );
+        }
+
+        cfg[TH_CHK_TH].diag.stuck = TH_CHK_STUCK;
+
+        p_ctx = th_chk_init( cfg );
+
+        if ( NULL != p_ctx )
+        {
+            is_pass = true;
+
+            // Noise of one LSB keeps sensor alive
+            for ( uint32_t i = 0; i < ( 4U * TH_CHK_STUCK ); i++ )
+            {
+                g_adc_raw[TH_CHK_TH] = (uint16_t) ( raw + ( i & 1U ));
+
+                is_pass &= ( eTH_OK == th_chk_step( p_ctx ).status );
+            }
+
+            // Frozen code, first sample still differs from previous one
+            g_adc_raw[TH_CHK_TH] = raw;
+            is_pass &= ( eTH_OK == th_chk_step( p_ctx ).status );
+
+            for ( uint32_t i = 1U; i < TH_CHK_STUCK; i++ )
+            {
+                is_pass &= ( eTH_OK == th_chk_step( p_ctx ).status );
+            }
+
+            is_pass &= ( eTH_ERROR_STUCK == th_chk_step( p_ctx ).status );
+
+            (void) th_ctx_deinit( p_ctx );
+        }
+
+        free( p_ctx );
+
+        return th_chk_print( "diag_stuck", is_pass );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Check confirmation of rate of change spike
+    *
+    * @note     Single sample spike shall be confirmed by debounce and
+    *           cleared again. Sensor returning from open into range
+    *           shall go to OK without rate of change status in between.
+    *
+    * @return       status  - Status of check
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_status_t th_chk_diag_rate(void)
+    {
+        th_cfg_t    cfg[TH_CHK_NUM_OF];
+        th_ctx_t *  p_ctx   = NULL;
+        bool        is_rate = false;
+        bool        is_pass = false;
+
+        for ( uint32_t th = 0; th < TH_CHK_NUM_OF; th++ )
+        {
+            th_chk_cfg( &cfg[th], (adc_ch_t) th );
+        }
+
+        // Filter follows step within one sample
+        cfg[TH_CHK_TH].range.debounce = TH_CHK_DEBOUNCE;
+        cfg[TH_CHK_TH].diag.rate_max  = 100.0f;
+        cfg[TH_CHK_TH].lpf_fc         = 40.0f;
+
+        p_ctx = th_chk_init( cfg );
+
+        if ( NULL != p_ctx )
+        {
+            // Single sample spike of 10 degC
+            g_adc_raw[TH_CHK_TH] = th_chk_raw( 35.0 );
+            is_rate |= ( eTH_ERROR_RATE == th_chk_step( p_ctx ).status );
+            g_adc_raw[TH_CHK_TH] = th_chk_raw( 25.0 );
+
+            for ( uint32_t i = 0; i < ( 2U * TH_CHK_DEBOUNCE ); i++ )
+            {
+                is_rate |= ( eTH_ERROR_RATE == th_chk_step( p_ctx ).status );
+            }
+
+            is_pass = ( true == is_rate );
+
+            for ( uint32_t i = 0; i < TH_CHK_DEBOUNCE; i++ )
+            {
+                (void) th_chk_step( p_ctx );
+            }
+
+            is_pass &= ( eTH_OK == th_chk_step( p_ctx ).status );
+
+            // Open sensor
+            g_adc_raw[TH_CHK_TH] = 0U;
+
+            for ( uint32_t i = 0; i < ( 4U * TH_CHK_DEBOUNCE ); i++ )
+            {
+                (void) th_chk_step( p_ctx );
+            }
+
+            is_pass &= ( eTH_ERROR_OPEN == th_chk_step( p_ctx ).status );
+
+            // Return into range is rate of change spike itself
+            g_adc_raw[TH_CHK_TH] = th_chk_raw( 25.0 );
+
+            for ( uint32_t i = 0; i < ( 4U * TH_CHK_DEBOUNCE ); i++ )
+            {
+                const uint8_t status = th_chk_step( p_ctx ).status;
+
+                is_pass &= (( eTH_ERROR_OPEN == status ) || ( eTH_OK == status ));
+            }
+
+            is_pass &= ( eTH_OK == th_chk_step( p_ctx ).status );
+
+            (void) th_ctx_deinit( p_ctx );
+        }
+
+        free( p_ctx );
+
+        return th_chk_print( "diag_rate", is_pass );
+    }
+
+#endif
+
+#if ( 1 == TH_EVENT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Wait for event of checked thermistor
+    *
+    * @param[in]    p_ctx   - Thermistor context
+    * @param[in]    type    - Expected event type
+    * @return       is_evt  - Event received
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool th_chk_wait_event(th_ctx_t * const p_ctx, const th_evt_type_t type)
+    {
+        th_event_t  evt     = {0};
+        bool        is_evt  = false;
+
+        for ( uint32_t i = 0; ( i < TH_CHK_CALLS_MAX ) && ( false == is_evt ); i++ )
+        {
+            (void) th_ctx_hndl( p_ctx );
+
+            while ( eTH_OK == th_ctx_get_event( p_ctx, &evt ))
+            {
+                is_evt |= (( TH_CHK_TH == evt.th ) && ( type == evt.type ));
+            }
+        }
+
+        return is_evt;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /*!
+    * @brief        Check threshold crossing events
+    *
+    * @note     Step over threshold shall report event above, step back
+    *           bellow threshold minus hysteresis event bellow.
+    *
+    * @return       status  - Status of check
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static th_status_t th_chk_event_thr(void)
+    {
+        th_cfg_t    cfg[TH_CHK_NUM_OF];
+        th_ctx_t *  p_ctx   = NULL;
+        bool        is_pass = false;
+
+        for ( uint32_t th = 0; th < TH_CHK_NUM_OF; th++ )
+        {
+            th_chk_cfg( &cfg[th], (adc_ch_t) th );
+        }
+
+        cfg[TH_CHK_TH].thr.temp   = 50.0f;
+        cfg[TH_CHK_TH].thr.hyst   = 2.0f;
+        cfg[TH_CHK_TH].thr.en     = true;
+
+        p_ctx = th_chk_init( cfg );
+
+        if ( NULL != p_ctx )
+        {
+            g_adc_raw[TH_CHK_TH] = th_chk_raw( 60.0 );
+            is_pass = th_chk_wait_event( p_ctx, eTH_EVT_THR_ABOVE );
+
+            g_adc_raw[TH_CHK_TH] = th_chk_raw( 25.0 );
+            is_pass &= th_chk_wait_event( p_ctx, eTH_EVT_THR_BELOW );
+
+            (void) th_ctx_deinit( p_ctx );
+        }
+
+        free( p_ctx );
+
+        return th_chk_print( "event_thr", is_pass );
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief        Run all checks of active configuration
+*
+* @return       status - 0 when all checks pass
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    th_status_t status = eTH_OK;
+
+    status |= th_chk_range_debounce();
+
+    #if ( 1 == TH_DIAG_EN )
+        status |= th_chk_diag_stuck();
+        status |= th_chk_diag_rate();
+    #endif
+
+    #if ( 1 == TH_EVENT_EN )
+        status |= th_chk_event_thr();
+    #endif
+
+    return ( eTH_OK == status ) ? 0 : 1;
+}
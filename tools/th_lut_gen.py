@@ -0,0 +1,200 @@
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+##
+## @file      th_lut_gen.py
+## @brief     Thermistor look-up table generator
+## @author    Ziga Miklosic
+## @email     ziga.miklosic@gmail.com
+## @date      16.10.2026
+## @version   V1.3.0
+##
+## @note      Generates constant ADC code to temperature table for
+##            TH_LUT_IN_FLASH mode. Calculations mirrors ones in
+##            "src/thermistor.c" but are done in double precision.
+##
+##            Example:
+##              python th_lut_gen.py --name g_th_lut_ntc --type ntc
+##                  --conn high --pull down --pull-down 4.7e3
+##                  --beta 3435 --nom 10e3 --adc-bits 12 --lut-bits 6
+##
+################################################################################
+import argparse
+import math
+
+################################################################################
+## Definitions
+################################################################################
+
+# Factor for NTC calculation when given nominal NTC value at 25 degC
+TH_NTC_25DEG_FACTOR = ( 1.0 / 298.15 )
+
+# PT100/500/1000 temperature calculation factors according to DIN EN60751
+TH_PT_DIN_EN60751_A = ( 3.9083e-3 )
+TH_PT_DIN_EN60751_B = ( -5.775e-7 )
+TH_PT_DIN_EN60751_C = ( -4.183e-12 )
+
+# Sensor resistance limits (nominal, min, max) in Ohm
+TH_RES_LIMITS = {
+    "ntc":      ( None,     1.0,        10e6 ),
+    "ntc_sh":   ( None,     1.0,        10e6 ),
+    "ntc_tab":  ( None,     1.0,        10e6 ),
+    "pt100":    ( 100.0,    18.52,      390.48 ),
+    "pt500":    ( 500.0,    114.13,     1937.74 ),
+    "pt1000":   ( 1000.0,   185.20,     3904.81 ),
+}
+
+################################################################################
+## Functions
+################################################################################
+
+def th_calc_resistance(args, raw, raw_max):
+    """ Calculate thermistor resistance from RAW ADC code """
+    adc   = raw + 1.0
+    ratio = raw_max / adc
+
+    # Both pull resistors, one of them parallel to thermistor
+    if "both" == args.pull:
+        g_pu = 1.0 / args.pull_up
+        g_pd = 1.0 / args.pull_down
+
+        if "low" == args.conn:
+            den = g_pu * ( raw_max - adc ) - g_pd * adc
+            res = ( adc / den ) if ( den > 0.0 ) else 1e6
+        else:
+            den = g_pd * adc - g_pu * ( raw_max - adc )
+            res = (( raw_max - adc ) / den ) if ( den > 0.0 ) else 1e6
+
+    # Thermistor on low side
+    elif "low" == args.conn:
+        res = ( args.pull_up / ( ratio - 1.0 )) if ( ratio > 1.0 ) else 1e6
+
+    # Thermistor on high side
+    else:
+        res = ( args.pull_down * ( ratio - 1.0 )) if ( ratio > 1.0 ) else 0.0
+
+    _, res_min, res_max = TH_RES_LIMITS[args.type]
+
+    return min( max( res, res_min ), res_max )
+
+def th_calc_temperature(args, rth):
+    """ Calculate temperature from thermistor resistance """
+    if "ntc" == args.type:
+        return ( 1.0 / ( TH_NTC_25DEG_FACTOR + (( 1.0 / args.beta ) * math.log( rth / args.nom )))) - 273.15
+
+    if "ntc_sh" == args.type:
+        ln_rth = math.log( rth )
+        return ( 1.0 / ( args.sh_a + args.sh_b * ln_rth + args.sh_c * ln_rth ** 3 )) - 273.15
+
+    if "ntc_tab" == args.type:
+        return th_calc_ntc_tab_temperature( args.rt_table, rth )
+
+    r0, _, _ = TH_RES_LIMITS[args.type]
+    a = TH_PT_DIN_EN60751_A
+    b = TH_PT_DIN_EN60751_B
+    c = TH_PT_DIN_EN60751_C
+    q = rth / r0
+    t = ( -a + math.sqrt( a * a - 4.0 * b * ( 1.0 - q ))) / ( 2.0 * b )
+
+    # Bellow 0 degC solve full Callendar-Van Dusen equation with Newton method
+    if q < 1.0:
+        for _ in range( 20 ):
+            f = 1.0 + a * t + b * t * t + c * ( t - 100.0 ) * t * t * t - q
+            d = a + 2.0 * b * t + c * ( 4.0 * t * t * t - 300.0 * t * t )
+            t = t - f / d
+
+    return t
+
+def th_calc_ntc_tab_temperature(rt_table, rth):
+    """ Calculate temperature from NTC R-T table, linear in ln(R) vs. 1/T """
+    ln_rth  = math.log( rth )
+    idx     = 0
+
+    # Find segment, first/last segment is extrapolated
+    while ( idx < len( rt_table ) - 2 ) and ( ln_rth < math.log( rt_table[idx+1][1] )):
+        idx += 1
+
+    ( t0, r0 ), ( t1, r1 ) = rt_table[idx], rt_table[idx+1]
+    k = (( 1.0 / ( t1 + 273.15 )) - ( 1.0 / ( t0 + 273.15 ))) / ( math.log( r1 ) - math.log( r0 ))
+
+    return ( 1.0 / (( 1.0 / ( t0 + 273.15 )) + k * ( ln_rth - math.log( r0 )))) - 273.15
+
+def th_load_rt_table(path):
+    """ Load NTC R-T table from CSV file with "temp,res" rows """
+    rt_table = []
+
+    with open( path ) as f:
+        for line in f:
+            line = line.strip()
+            if line and not line.startswith( "#" ):
+                temp, res = line.split( "," )[:2]
+                rt_table.append(( float( temp ), float( res )))
+
+    return rt_table
+
+def th_lut_gen(args):
+    """ Generate look-up table as C source """
+    raw_max = ( 1 << args.adc_bits ) - 1
+    shift   = args.adc_bits - args.lut_bits
+    size    = ( 1 << args.lut_bits ) + 1
+    points  = []
+
+    for i in range( size ):
+        raw = min( i << shift, raw_max )
+        points.append( th_calc_temperature( args, th_calc_resistance( args, raw, raw_max )))
+
+    out =  "/**\n"
+    out += " *  Look-up table: %s, %d-bit ADC, %d-bit table\n" % ( args.type.upper(), args.adc_bits, args.lut_bits )
+    out += " *\n"
+    out += " *  @note   Generated by tools/th_lut_gen.py - do not edit!\n"
+    out += " *\n"
+    out += " *  Unit: %s\n" % ( "milli degC" if args.fixed else "degC" )
+    out += " */\n"
+    out += "static const th_lut_t %s[] =\n{\n" % args.name
+
+    for i in range( 0, size, 8 ):
+        if args.fixed:
+            out += "    " + " ".join( "%d," % round( p * 1e3 ) for p in points[i:i+8] ) + "\n"
+        else:
+            out += "    " + " ".join( "%.4ff," % p for p in points[i:i+8] ) + "\n"
+
+    out += "};\n\n"
+    out += "_Static_assert( TH_LUT_SIZE == ( sizeof( %s ) / sizeof( th_lut_t )), \"Table size mismatch with TH_LUT_RES_BITS!\" );\n" % args.name
+
+    return out
+
+################################################################################
+## Main
+################################################################################
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser( description="Thermistor look-up table generator" )
+    parser.add_argument( "--name",      required=True,                                  help="Name of C table" )
+    parser.add_argument( "--type",      required=True, choices=TH_RES_LIMITS.keys(),   help="Sensor type" )
+    parser.add_argument( "--conn",      required=True, choices=[ "low", "high" ],       help="Thermistor connection" )
+    parser.add_argument( "--pull",      required=True, choices=[ "up", "down", "both" ],help="Pull resistor connection" )
+    parser.add_argument( "--pull-up",   type=float, default=0.0,                        help="Pull-up resistance in Ohm" )
+    parser.add_argument( "--pull-down", type=float, default=0.0,                        help="Pull-down resistance in Ohm" )
+    parser.add_argument( "--beta",      type=float, default=0.0,                        help="NTC beta factor" )
+    parser.add_argument( "--nom",       type=float, default=0.0,                        help="NTC nominal value @25degC in Ohm" )
+    parser.add_argument( "--sh-a",      type=float, default=0.0,                        help="NTC Steinhart-Hart coefficient A" )
+    parser.add_argument( "--sh-b",      type=float, default=0.0,                        help="NTC Steinhart-Hart coefficient B" )
+    parser.add_argument( "--sh-c",      type=float, default=0.0,                        help="NTC Steinhart-Hart coefficient C" )
+    parser.add_argument( "--rt-table",  type=str,   default=None,                       help="NTC R-T table CSV file (temp,res per line)" )
+    parser.add_argument( "--adc-bits",  type=int,   required=True,                      help="ADC resolution in bits" )
+    parser.add_argument( "--lut-bits",  type=int,   required=True,                      help="Table resolution in bits (TH_LUT_RES_BITS)" )
+    parser.add_argument( "--fixed",     action="store_true",                            help="Table in milli degC (TH_FIXED_POINT_EN)" )
+    args = parser.parse_args()
+
+    if args.lut_bits > args.adc_bits:
+        parser.error( "Table resolution higher than ADC resolution!" )
+
+    if ( "both" == args.pull ) and (( args.pull_up <= 0.0 ) or ( args.pull_down <= 0.0 )):
+        parser.error( "Both pull resistors must be given!" )
+
+    if "ntc_tab" == args.type:
+        if args.rt_table is None:
+            parser.error( "R-T table file missing!" )
+        args.rt_table = th_load_rt_table( args.rt_table )
+
+    print( th_lut_gen( args ))